@@ -8,6 +8,7 @@
 #include "BehaviorTree/BehaviorTree.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "NavigationSystem.h"
+#include "TimerManager.h"
 
 AYomiAIController::AYomiAIController()
 {
@@ -56,6 +57,36 @@ void AYomiAIController::OnPossess(APawn* InPawn)
 
 		// Start behavior tree if available
 		// RunBehaviorTree(Enemy->BehaviorTree);
+
+		if (Enemy->IsAggressive())
+		{
+			// Staggered so a freshly spawned pack does not scan on the same frame
+			GetWorldTimerManager().SetTimer(AggroScanTimerHandle, this, &AYomiAIController::ScanForAggroTarget,
+				AggroScanInterval, true, FMath::FRandRange(0.0f, AggroScanInterval));
+		}
+	}
+}
+
+void AYomiAIController::OnUnPossess()
+{
+	GetWorldTimerManager().ClearTimer(AggroScanTimerHandle);
+	Super::OnUnPossess();
+}
+
+void AYomiAIController::ScanForAggroTarget()
+{
+	AYomiEnemyBase* ControlledEnemy = Cast<AYomiEnemyBase>(GetPawn());
+	if (!ControlledEnemy || !ControlledEnemy->IsAlive())
+	{
+		GetWorldTimerManager().ClearTimer(AggroScanTimerHandle);
+		return;
+	}
+
+	if (ControlledEnemy->GetCurrentTarget()) return;
+
+	if (AYomiCharacterBase* Target = ControlledEnemy->FindAggroTarget())
+	{
+		ControlledEnemy->OnPlayerDetected(Target);
 	}
 }
 
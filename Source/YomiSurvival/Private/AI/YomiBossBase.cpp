@@ -47,6 +47,7 @@ void AYomiBossBase::StartEncounter(AActor* InChallenger)
 	EncounterTimer = 0.0f;
 	TotalDamageTakenByPlayer = 0.0f;
 	MinionsKilledByPlayer = 0;
+	RefreshTickEnabled();
 
 	ActivateArena();
 	OnPlayerDetected(InChallenger);
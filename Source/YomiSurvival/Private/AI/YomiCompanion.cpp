@@ -2,7 +2,10 @@
 
 #include "AI/YomiCompanion.h"
 #include "Character/YomiPlayerCharacter.h"
+#include "Character/YomiCharacterRegistry.h"
+#include "World/YomiResourceNode.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "Engine/OverlapResult.h"
 
 AYomiCompanion::AYomiCompanion()
 {
@@ -12,6 +15,8 @@ AYomiCompanion::AYomiCompanion()
 	MaxStamina = 100.0f;
 	HealthRegenRate = 5.0f;
 
+	Team = EYomiTeam::Companions;
+
 	if (GetCharacterMovement())
 	{
 		GetCharacterMovement()->MaxWalkSpeed = 800.0f;
@@ -27,6 +32,7 @@ void AYomiCompanion::InitializeCompanion(ECompanionType InType, AYomiPlayerChara
 {
 	CompanionType = InType;
 	CompanionOwner = InOwner;
+	RefreshTickEnabled();
 
 	// Set stats based on companion type
 	switch (CompanionType)
@@ -46,7 +52,7 @@ void AYomiCompanion::InitializeCompanion(ECompanionType InType, AYomiPlayerChara
 	case ECompanionType::SpiritWolf:
 		CompanionName = FText::FromString(TEXT("Spirit Wolf"));
 		DetectionRadius = 1000.0f; // Assists in combat
-		MaxHealth = 400.0f;
+		SetAttributeBase(EYomiAttribute::MaxHealth, 400.0f);
 		break;
 	case ECompanionType::CraneSpirit:
 		CompanionName = FText::FromString(TEXT("Crane Spirit"));
@@ -100,23 +106,52 @@ void AYomiCompanion::FollowOwner(float DeltaTime)
 
 void AYomiCompanion::ScanForPointsOfInterest()
 {
-	// Scan for nearby resources and enemies
-	if (!GetWorld()) return;
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	// Scan for nearby enemies
+	if (const UYomiCharacterRegistry* Registry = World->GetSubsystem<UYomiCharacterRegistry>())
+	{
+		FYomiCharacterFilter Filter;
+		Filter.ExcludeAlliesOf = Team;
+		Filter.KindMask = FYomiCharacterFilter::KindBit(EYomiCharacterKind::Enemy) | FYomiCharacterFilter::KindBit(EYomiCharacterKind::Boss);
+		Filter.IgnoreActor = this;
+
+		if (AYomiCharacterBase* Enemy = Registry->FindNearestCharacter(GetActorLocation(), DetectionRadius, Filter))
+		{
+			OnEnemyDetected(Enemy);
+		}
+	}
 
-	TArray<FHitResult> Hits;
-	FCollisionShape Sphere = FCollisionShape::MakeSphere(DetectionRadius);
+	// Scan for the nearest resource node that still has something to harvest
+	TArray<FOverlapResult> Overlaps;
 	FCollisionQueryParams Params;
 	Params.AddIgnoredActor(this);
 	if (CompanionOwner) Params.AddIgnoredActor(CompanionOwner);
 
-	if (GetWorld()->SweepMultiByChannel(Hits, GetActorLocation(), GetActorLocation(),
-		FQuat::Identity, ECC_Visibility, Sphere, Params))
+	World->OverlapMultiByObjectType(Overlaps, GetActorLocation(), FQuat::Identity,
+		FCollisionObjectQueryParams(FCollisionObjectQueryParams::AllObjects),
+		FCollisionShape::MakeSphere(DetectionRadius), Params);
+
+	AYomiResourceNode* NearestResource = nullptr;
+	float NearestDistSq = TNumericLimits<float>::Max();
+	for (const FOverlapResult& Overlap : Overlaps)
 	{
-		for (const FHitResult& Hit : Hits)
+		AYomiResourceNode* Node = Cast<AYomiResourceNode>(Overlap.GetActor());
+		if (!Node || Node->IsDepleted()) continue;
+
+		const float DistSq = FVector::DistSquared(GetActorLocation(), Node->GetActorLocation());
+		if (DistSq < NearestDistSq)
 		{
-			// In full implementation, check for resource nodes and enemies
+			NearestDistSq = DistSq;
+			NearestResource = Node;
 		}
 	}
+
+	if (NearestResource)
+	{
+		OnResourceDetected(NearestResource);
+	}
 }
 
 void AYomiCompanion::OnResourceDetected(AActor* Resource)
@@ -2,7 +2,14 @@
 
 #include "AI/YomiEnemyBase.h"
 #include "Character/YomiPlayerCharacter.h"
+#include "Character/YomiCharacterRegistry.h"
+#include "Combat/YomiDamageSubsystem.h"
+#include "Combat/YomiLagCompensationSubsystem.h"
+#include "Combat/YomiAimSubsystem.h"
+#include "Combat/YomiProjectile.h"
+#include "Combat/YomiProjectileSubsystem.h"
 #include "BehaviorTree/BehaviorTree.h"
+#include "Engine/Engine.h"
 
 AYomiEnemyBase::AYomiEnemyBase()
 {
@@ -12,6 +19,26 @@ AYomiEnemyBase::AYomiEnemyBase()
 	MaxHealth = 50.0f;
 	MaxStamina = 50.0f;
 	HealthRegenRate = 0.0f;
+
+	Team = EYomiTeam::Yokai;
+}
+
+AYomiEnemyBase* AYomiEnemyBase::SpawnEnemy(UObject* WorldContextObject, TSubclassOf<AYomiEnemyBase> EnemyClass, const FTransform& Transform)
+{
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+	if (!World || !EnemyClass) return nullptr;
+
+	// Both paths move the enemy out of blocking geometry rather than refusing the spawn
+	constexpr ESpawnActorCollisionHandlingMethod CollisionHandling = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	if (UYomiActorPoolSubsystem* Pool = World->GetSubsystem<UYomiActorPoolSubsystem>())
+	{
+		return Pool->AcquireActor<AYomiEnemyBase>(EnemyClass, Transform, nullptr, nullptr, [](AActor*) {}, CollisionHandling);
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = CollisionHandling;
+	return World->SpawnActor<AYomiEnemyBase>(EnemyClass, Transform, SpawnParams);
 }
 
 void AYomiEnemyBase::BeginPlay()
@@ -22,15 +49,30 @@ void AYomiEnemyBase::BeginPlay()
 void AYomiEnemyBase::OnPlayerDetected(AActor* Player)
 {
 	CurrentTarget = Player;
+	UpdateAimTracking();
 	UE_LOG(LogYomiAI, Log, TEXT("%s detected player: %s"), *GetName(), *Player->GetName());
 }
 
 void AYomiEnemyBase::OnPlayerLost()
 {
 	CurrentTarget = nullptr;
+	UpdateAimTracking();
 	UE_LOG(LogYomiAI, Log, TEXT("%s lost sight of player"), *GetName());
 }
 
+AYomiCharacterBase* AYomiEnemyBase::FindAggroTarget() const
+{
+	const UYomiCharacterRegistry* Registry = GetWorld() ? GetWorld()->GetSubsystem<UYomiCharacterRegistry>() : nullptr;
+	if (!Registry || !bIsAggressive || !IsAlive()) return nullptr;
+
+	FYomiCharacterFilter Filter;
+	Filter.ExcludeAlliesOf = Team;
+	Filter.KindMask = FYomiCharacterFilter::KindBit(EYomiCharacterKind::Player) | FYomiCharacterFilter::KindBit(EYomiCharacterKind::Companion);
+	Filter.IgnoreActor = this;
+
+	return Registry->FindNearestCharacter(GetActorLocation(), AggroRange, Filter);
+}
+
 void AYomiEnemyBase::ExecuteAttack()
 {
 	if (!CurrentTarget || !IsAlive()) return;
@@ -38,15 +80,58 @@ void AYomiEnemyBase::ExecuteAttack()
 	float Distance = FVector::Dist(GetActorLocation(), CurrentTarget->GetActorLocation());
 	if (Distance > AttackRange) return;
 
+	if (RangedProjectileClass)
+	{
+		ExecuteRangedAttack();
+		return;
+	}
+
 	AYomiCharacterBase* TargetCharacter = Cast<AYomiCharacterBase>(CurrentTarget);
-	if (TargetCharacter)
+	UYomiDamageSubsystem* DamageSubsystem = GetWorld()->GetSubsystem<UYomiDamageSubsystem>();
+	if (TargetCharacter && DamageSubsystem)
 	{
-		TargetCharacter->ApplyDamage(AttackDamage, AttackDamageType, this);
+		DamageSubsystem->QueueDamage(TargetCharacter, AttackDamage, AttackDamageType, this, EDamageSource::Melee);
 		UE_LOG(LogYomiAI, Verbose, TEXT("%s attacked %s for %f damage"),
 			*GetName(), *CurrentTarget->GetName(), AttackDamage);
 	}
 }
 
+void AYomiEnemyBase::ExecuteRangedAttack()
+{
+	UYomiAimSubsystem* Aim = GetWorld()->GetSubsystem<UYomiAimSubsystem>();
+	UYomiProjectileSubsystem* ProjectileSubsystem = GetWorld()->GetSubsystem<UYomiProjectileSubsystem>();
+	if (!Aim || !ProjectileSubsystem) return;
+
+	FVector Direction;
+	float TimeOfFlight;
+	if (!Aim->GetAimSolution(this, Direction, TimeOfFlight))
+	{
+		// Not solved yet, or no arc reaches the target at this speed
+		return;
+	}
+
+	ProjectileSubsystem->LaunchProjectile(RangedProjectileClass, Aim->GetMuzzleLocation(this), Direction, RangedProjectileSpeed,
+		AttackDamage, AttackDamageType, this);
+
+	UE_LOG(LogYomiAI, Verbose, TEXT("%s fired at %s (%.2fs flight)"), *GetName(), *CurrentTarget->GetName(), TimeOfFlight);
+}
+
+void AYomiEnemyBase::UpdateAimTracking()
+{
+	UYomiAimSubsystem* Aim = GetWorld() ? GetWorld()->GetSubsystem<UYomiAimSubsystem>() : nullptr;
+	if (!Aim || !RangedProjectileClass) return;
+
+	if (CurrentTarget && IsAlive())
+	{
+		const float GravityScale = RangedProjectileClass->GetDefaultObject<AYomiProjectile>()->GetGravityScale();
+		Aim->TrackTarget(this, CurrentTarget, RangedProjectileSpeed, GravityScale, RangedMuzzleOffset);
+	}
+	else
+	{
+		Aim->StopTracking(this);
+	}
+}
+
 void AYomiEnemyBase::ExecuteSpecialAbility()
 {
 	// Override in subclasses for unique yokai abilities
@@ -103,7 +188,65 @@ void AYomiEnemyBase::Die()
 	}
 
 	Super::Die();
+	UpdateAimTracking();
+
+	// Recycle after the death animation
+	if (UYomiActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UYomiActorPoolSubsystem>())
+	{
+		Pool->ReleaseActorAfter(this, CorpseLifeSpan);
+	}
+	else
+	{
+		SetLifeSpan(CorpseLifeSpan);
+	}
+}
+
+void AYomiEnemyBase::OnAcquiredFromPool()
+{
+	const float Now = GetRegenTime();
+	HealthStat.Set(MaxHealth, MaxHealth, Now);
+	StaminaStat.Set(MaxStamina, MaxStamina, Now);
+	UpdateRegenRates();
+	MarkHealthDirty();
+	MarkStaminaDirty();
+
+	if (UYomiCharacterRegistry* Registry = GetWorld()->GetSubsystem<UYomiCharacterRegistry>())
+	{
+		Registry->RegisterCharacter(this);
+	}
+
+	if (UYomiLagCompensationSubsystem* LagCompensation = GetWorld()->GetSubsystem<UYomiLagCompensationSubsystem>())
+	{
+		LagCompensation->RegisterCharacter(this);
+	}
 
-	// Destroy after delay for death animation
-	SetLifeSpan(5.0f);
+	if (HasAuthority() && !Controller)
+	{
+		SpawnDefaultController();
+	}
+}
+
+void AYomiEnemyBase::OnReturnedToPool()
+{
+	CurrentTarget = nullptr;
+	UpdateAimTracking();
+	bKilledHonorably = false;
+	AttackCooldownTimer = 0.0f;
+
+	if (UYomiCharacterRegistry* Registry = GetWorld()->GetSubsystem<UYomiCharacterRegistry>())
+	{
+		Registry->UnregisterCharacter(this);
+	}
+
+	if (UYomiLagCompensationSubsystem* LagCompensation = GetWorld()->GetSubsystem<UYomiLagCompensationSubsystem>())
+	{
+		LagCompensation->UnregisterCharacter(this);
+	}
+
+	// A fresh controller is spawned when the enemy is handed out again; its scan timers go with it
+	if (HasAuthority() && Controller)
+	{
+		GetWorldTimerManager().ClearAllTimersForObject(Controller);
+		DetachFromControllerPendingDestroy();
+	}
 }
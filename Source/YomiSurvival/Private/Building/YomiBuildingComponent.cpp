@@ -2,6 +2,8 @@
 
 #include "Building/YomiBuildingComponent.h"
 #include "Building/YomiBuildingPiece.h"
+#include "Building/YomiBuildingSubsystem.h"
+#include "Core/YomiActorPoolSubsystem.h"
 #include "Inventory/YomiInventoryComponent.h"
 #include "Engine/DataTable.h"
 #include "GameFramework/Character.h"
@@ -11,6 +13,7 @@ UYomiBuildingComponent::UYomiBuildingComponent()
 {
 	PrimaryComponentTick.bCanEverTick = true;
 	PrimaryComponentTick.bStartWithTickEnabled = false;
+	SetIsReplicatedByDefault(true);
 }
 
 void UYomiBuildingComponent::BeginPlay()
@@ -30,8 +33,15 @@ void UYomiBuildingComponent::BeginPlay()
 			if (Row)
 			{
 				AvailablePieceIDs.Add(Row->PieceID);
+				PieceDataByID.Add(Row->PieceID, *Row);
 			}
 		}
+
+		// Pieces only replicate their ID; share the definitions so clients can look the rest up
+		if (UYomiBuildingSubsystem* Subsystem = GetWorld()->GetSubsystem<UYomiBuildingSubsystem>())
+		{
+			Subsystem->AddPieceDefinitions(PieceDataByID);
+		}
 	}
 }
 
@@ -110,20 +120,13 @@ void UYomiBuildingComponent::CycleBuildingPieceBackward()
 
 FBuildingPieceData UYomiBuildingComponent::GetSelectedPieceData() const
 {
-	if (BuildingPieceDataTable && !SelectedPieceID.IsNone())
-	{
-		TArray<FBuildingPieceData*> Rows;
-		BuildingPieceDataTable->GetAllRows(TEXT("BuildingPieces"), Rows);
+	const FBuildingPieceData* Data = FindPieceData(SelectedPieceID);
+	return Data ? *Data : FBuildingPieceData();
+}
 
-		for (const FBuildingPieceData* Row : Rows)
-		{
-			if (Row && Row->PieceID == SelectedPieceID)
-			{
-				return *Row;
-			}
-		}
-	}
-	return FBuildingPieceData();
+const FBuildingPieceData* UYomiBuildingComponent::FindPieceData(FName PieceID) const
+{
+	return PieceID.IsNone() ? nullptr : PieceDataByID.Find(PieceID);
 }
 
 // ============================================================================
@@ -209,6 +212,199 @@ void UYomiBuildingComponent::UpdateGhostPlacement()
 	GhostPiece->SetGhostValid(bCanPlace);
 }
 
+// ============================================================================
+// BLUEPRINTS
+// ============================================================================
+
+bool UYomiBuildingComponent::SaveBlueprint(FName BlueprintID, const TArray<AYomiBuildingPiece*>& Pieces)
+{
+	if (BlueprintID.IsNone()) return false;
+
+	FBuildingBlueprint Blueprint;
+	Blueprint.BlueprintID = BlueprintID;
+
+	// Pieces are stored relative to the first valid piece, yaw only, so the blueprint can be rotated freely
+	FTransform Origin;
+	bool bHasOrigin = false;
+
+	for (const AYomiBuildingPiece* Piece : Pieces)
+	{
+		if (!Piece || Piece->IsGhost() || Piece->IsDestroyed()) continue;
+
+		if (!bHasOrigin)
+		{
+			Origin = FTransform(FRotator(0.0f, Piece->GetActorRotation().Yaw, 0.0f), Piece->GetActorLocation());
+			bHasOrigin = true;
+		}
+
+		FBuildingBlueprintPiece& Entry = Blueprint.Pieces.AddDefaulted_GetRef();
+		Entry.PieceID = Piece->GetPieceData().PieceID;
+		Entry.RelativeTransform = Piece->GetActorTransform().GetRelativeTransform(Origin);
+
+		// The server refuses blueprints that spread further than this
+		if (Entry.RelativeTransform.GetLocation().SizeSquared() > FMath::Square(MaxBlueprintExtent)) return false;
+	}
+
+	if (Blueprint.Pieces.Num() == 0 || Blueprint.Pieces.Num() > MaxBlueprintPieces) return false;
+
+	SavedBlueprints.Add(BlueprintID, MoveTemp(Blueprint));
+	UE_LOG(LogYomiBuilding, Log, TEXT("Saved building blueprint %s (%d pieces)"), *BlueprintID.ToString(), SavedBlueprints[BlueprintID].Pieces.Num());
+	return true;
+}
+
+void UYomiBuildingComponent::DeleteBlueprint(FName BlueprintID)
+{
+	SavedBlueprints.Remove(BlueprintID);
+}
+
+TArray<FName> UYomiBuildingComponent::GetSavedBlueprintIDs() const
+{
+	TArray<FName> IDs;
+	SavedBlueprints.GetKeys(IDs);
+	return IDs;
+}
+
+TMap<EResourceType, int32> UYomiBuildingComponent::GetBlueprintCost(const FBuildingBlueprint& Blueprint) const
+{
+	TMap<EResourceType, int32> TotalCost;
+	for (const FBuildingBlueprintPiece& Entry : Blueprint.Pieces)
+	{
+		if (const FBuildingPieceData* Data = FindPieceData(Entry.PieceID))
+		{
+			for (const auto& Pair : Data->BuildCost)
+			{
+				TotalCost.FindOrAdd(Pair.Key) += Pair.Value;
+			}
+		}
+	}
+	return TotalCost;
+}
+
+bool UYomiBuildingComponent::PlaceBlueprint(FName BlueprintID)
+{
+	const FBuildingBlueprint* Blueprint = SavedBlueprints.Find(BlueprintID);
+	if (!Blueprint || Blueprint->Pieces.Num() == 0) return false;
+
+	// Early out locally; the server repeats the check authoritatively
+	if (!OwnerInventory || !OwnerInventory->HasResources(GetBlueprintCost(*Blueprint))) return false;
+
+	// Both sides load the same piece table, so a row index stands in for the piece name
+	TArray<FYomiBlueprintSlot> Slots;
+	Slots.Reserve(Blueprint->Pieces.Num());
+	for (const FBuildingBlueprintPiece& Entry : Blueprint->Pieces)
+	{
+		const int32 PieceIndex = AvailablePieceIDs.IndexOfByKey(Entry.PieceID);
+		if (PieceIndex == INDEX_NONE || PieceIndex > MAX_uint16) return false;
+
+		FYomiBlueprintSlot& Slot = Slots.AddDefaulted_GetRef();
+		Slot.PieceIndex = static_cast<uint16>(PieceIndex);
+		Slot.Yaw = FRotator::CompressAxisToShort(Entry.RelativeTransform.Rotator().Yaw);
+		Slot.Offset = Entry.RelativeTransform.GetLocation();
+	}
+
+	ServerPlaceBlueprint(Blueprint->BlueprintID, Slots, FTransform(GetPlacementRotation(), GetPlacementLocation()));
+	return true;
+}
+
+void UYomiBuildingComponent::ServerPlaceBlueprint_Implementation(FName BlueprintID, const TArray<FYomiBlueprintSlot>& Slots, FTransform Origin)
+{
+	UWorld* World = GetWorld();
+	if (!World || !OwnerInventory) return;
+
+	const int32 NumPieces = Slots.Num();
+	if (NumPieces == 0 || NumPieces > MaxBlueprintPieces) return;
+
+	// Origin must be within reach, as it would be for a single piece
+	if (Origin.ContainsNaN() || FVector::DistSquared(Origin.GetLocation(), GetOwner()->GetActorLocation()) > FMath::Square(PlacementDistance + SnapDistance))
+	{
+		return;
+	}
+
+	// The blueprint arrives from the client; only yaw and unit scale are ever placed
+	Origin = FTransform(FRotator(0.0f, Origin.Rotator().Yaw, 0.0f), Origin.GetLocation());
+
+	// Rebuilt from the slots so cost and data lookups go through the same paths as saved blueprints
+	FBuildingBlueprint Blueprint;
+	Blueprint.BlueprintID = BlueprintID;
+	Blueprint.Pieces.Reserve(NumPieces);
+
+	TArray<FBuildingPieceData> PieceData;
+	TArray<FTransform> Transforms;
+	TArray<FVector> SnapSizes;
+	PieceData.Reserve(NumPieces);
+	Transforms.Reserve(NumPieces);
+	SnapSizes.Reserve(NumPieces);
+
+	for (const FYomiBlueprintSlot& Slot : Slots)
+	{
+		const FBuildingPieceData* Data = AvailablePieceIDs.IsValidIndex(Slot.PieceIndex) ? FindPieceData(AvailablePieceIDs[Slot.PieceIndex]) : nullptr;
+		if (!Data)
+		{
+			UE_LOG(LogYomiBuilding, Warning, TEXT("Blueprint %s references unknown piece index %d"), *BlueprintID.ToString(), Slot.PieceIndex);
+			return;
+		}
+
+		const FVector Offset = Slot.Offset;
+		if (Offset.ContainsNaN() || Offset.SizeSquared() > FMath::Square(MaxBlueprintExtent))
+		{
+			UE_LOG(LogYomiBuilding, Warning, TEXT("Blueprint %s has piece %s outside its allowed extent"),
+				*BlueprintID.ToString(), *Data->PieceID.ToString());
+			return;
+		}
+
+		FBuildingBlueprintPiece& Entry = Blueprint.Pieces.AddDefaulted_GetRef();
+		Entry.PieceID = Data->PieceID;
+		Entry.RelativeTransform = FTransform(FRotator(0.0f, FRotator::DecompressAxisFromShort(Slot.Yaw), 0.0f), Offset);
+
+		const FTransform WorldSlot = Entry.RelativeTransform * Origin;
+
+		// Same world check a single piece gets
+		if (!CheckPlacementCollision(WorldSlot.GetLocation()))
+		{
+			UE_LOG(LogYomiBuilding, Log, TEXT("Blueprint %s blocked by world geometry"), *BlueprintID.ToString());
+			return;
+		}
+
+		PieceData.Add(*Data);
+		Transforms.Add(WorldSlot);
+		SnapSizes.Add(Data->SnapSize);
+	}
+
+	UYomiBuildingSubsystem* Subsystem = World->GetSubsystem<UYomiBuildingSubsystem>();
+	if (!Subsystem) return;
+
+	if (!Subsystem->ValidatePlacements(Transforms, SnapSizes))
+	{
+		UE_LOG(LogYomiBuilding, Log, TEXT("Blueprint %s blocked by existing or queued pieces"), *Blueprint.BlueprintID.ToString());
+		return;
+	}
+
+	// One aggregate check and consumption for the whole blueprint
+	const TMap<EResourceType, int32> TotalCost = GetBlueprintCost(Blueprint);
+	if (!OwnerInventory->HasResources(TotalCost) || !OwnerInventory->ConsumeResources(TotalCost)) return;
+
+	Subsystem->EnqueuePlacementBatch(Blueprint.BlueprintID, MoveTemp(PieceData), MoveTemp(Transforms), GetOwner(), this);
+}
+
+void UYomiBuildingComponent::NotifyBlueprintPlaced(FName BlueprintID, const TArray<AYomiBuildingPiece*>& PlacedPieces)
+{
+	OnBlueprintPlaced.Broadcast(BlueprintID, PlacedPieces.Num());
+
+	// A remote owner only hears about it through its own copy of the component
+	const APawn* OwnerPawn = Cast<APawn>(GetOwner());
+	if (OwnerPawn && !OwnerPawn->IsLocallyControlled())
+	{
+		ClientBlueprintPlaced(BlueprintID, PlacedPieces.Num());
+	}
+
+	UE_LOG(LogYomiBuilding, Log, TEXT("Placed building blueprint %s (%d pieces)"), *BlueprintID.ToString(), PlacedPieces.Num());
+}
+
+void UYomiBuildingComponent::ClientBlueprintPlaced_Implementation(FName BlueprintID, int32 NumPieces)
+{
+	OnBlueprintPlaced.Broadcast(BlueprintID, NumPieces);
+}
+
 // ============================================================================
 // DEMOLITION
 // ============================================================================
@@ -305,23 +501,31 @@ AYomiBuildingPiece* UYomiBuildingComponent::FindNearestSnapPoint(FVector Locatio
 
 void UYomiBuildingComponent::CreateGhostPiece()
 {
-	if (!GetWorld()) return;
-
-	FActorSpawnParameters SpawnParams;
-	GhostPiece = GetWorld()->SpawnActor<AYomiBuildingPiece>(
-		AYomiBuildingPiece::StaticClass(), FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
-
-	if (GhostPiece)
-	{
-		GhostPiece->SetAsGhost(true);
-	}
+	UYomiActorPoolSubsystem* Pool = GetWorld() ? GetWorld()->GetSubsystem<UYomiActorPoolSubsystem>() : nullptr;
+	if (!Pool) return;
+
+	// The ghost is recycled on every selection change. A recycled ghost is flagged before its
+	// components re-register; a fresh one has no mesh yet when its components first register,
+	// so the preview never adds geometry to the navmesh
+	GhostPiece = Pool->AcquireActor<AYomiBuildingPiece>(AYomiBuildingPiece::StaticClass(), FTransform::Identity, nullptr, nullptr,
+		[](AActor* Actor)
+		{
+			CastChecked<AYomiBuildingPiece>(Actor)->SetAsGhost(true);
+		});
 }
 
 void UYomiBuildingComponent::DestroyGhostPiece()
 {
 	if (GhostPiece)
 	{
-		GhostPiece->Destroy();
+		if (UYomiActorPoolSubsystem* Pool = GetWorld() ? GetWorld()->GetSubsystem<UYomiActorPoolSubsystem>() : nullptr)
+		{
+			Pool->ReleaseActor(GhostPiece);
+		}
+		else
+		{
+			GhostPiece->Destroy();
+		}
 		GhostPiece = nullptr;
 	}
 }
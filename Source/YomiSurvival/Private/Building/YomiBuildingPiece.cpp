@@ -1,8 +1,12 @@
 // Copyright (c) 2026 Yomi Survival. All Rights Reserved.
 
 #include "Building/YomiBuildingPiece.h"
+#include "Building/YomiBuildingResistance.h"
+#include "Building/YomiBuildingSubsystem.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/BoxComponent.h"
+#include "NavModifierComponent.h"
+#include "NavAreas/NavArea_Obstacle.h"
 #include "Net/UnrealNetwork.h"
 
 AYomiBuildingPiece::AYomiBuildingPiece()
@@ -10,6 +14,12 @@ AYomiBuildingPiece::AYomiBuildingPiece()
 	PrimaryActorTick.bCanEverTick = false;
 	bReplicates = true;
 
+	// Pieces almost never change after placement. Stay dormant and only flush
+	// dormancy when the quantised health actually changes.
+	NetDormancy = DORM_DormantAll;
+	NetUpdateFrequency = 1.0f;
+	MinNetUpdateFrequency = 0.2f;
+
 	MeshComponent = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("Mesh"));
 	SetRootComponent(MeshComponent);
 
@@ -17,13 +27,42 @@ AYomiBuildingPiece::AYomiBuildingPiece()
 	CollisionBox->SetupAttachment(MeshComponent);
 	CollisionBox->SetBoxExtent(FVector(100.0f));
 
+	// The mesh carries the navigation geometry; the box would only rasterise the same volume twice
+	CollisionBox->SetCanEverAffectNavigation(false);
+
 	CurrentHealth = 100.0f;
 }
 
+void AYomiBuildingPiece::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (!bIsGhost)
+	{
+		RegisterWithSubsystem();
+	}
+}
+
+void AYomiBuildingPiece::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnregisterFromSubsystem();
+	Super::EndPlay(EndPlayReason);
+}
+
 void AYomiBuildingPiece::InitializePiece(const FBuildingPieceData& InData)
+{
+	CurrentHealth = InData.MaxHealth;
+	ReplicatedHealth = 255;
+	ReplicatedPieceID = InData.PieceID;
+	ApplyPieceData(InData);
+
+	UE_LOG(LogYomiBuilding, Verbose, TEXT("Building piece initialized: %s (HP: %f)"),
+		*PieceData.DisplayName.ToString(), CurrentHealth);
+}
+
+void AYomiBuildingPiece::ApplyPieceData(const FBuildingPieceData& InData)
 {
 	PieceData = InData;
-	CurrentHealth = PieceData.MaxHealth;
 
 	// Load mesh if set
 	if (!PieceData.Mesh.IsNull())
@@ -38,44 +77,54 @@ void AYomiBuildingPiece::InitializePiece(const FBuildingPieceData& InData)
 	// Set collision box to match snap size
 	CollisionBox->SetBoxExtent(PieceData.SnapSize * 0.5f);
 
-	UE_LOG(LogYomiBuilding, Log, TEXT("Building piece initialized: %s (HP: %f)"),
-		*PieceData.DisplayName.ToString(), CurrentHealth);
+	// Footprint, roof and comfort may have changed with the new data
+	if (!bIsGhost && !IsDestroyed() && HasActorBegunPlay())
+	{
+		RegisterWithSubsystem();
+	}
+}
+
+void AYomiBuildingPiece::ResolvePieceData()
+{
+	if (HasAuthority() || ReplicatedPieceID.IsNone() || PieceData.PieceID == ReplicatedPieceID) return;
+
+	const UYomiBuildingSubsystem* BuildingSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UYomiBuildingSubsystem>() : nullptr;
+	const FBuildingPieceData* Definition = BuildingSubsystem ? BuildingSubsystem->FindPieceDefinition(ReplicatedPieceID) : nullptr;
+	if (!Definition) return;
+
+	ApplyPieceData(*Definition);
+	OnRep_HealthByte();
 }
 
 float AYomiBuildingPiece::TakeDamage(float DamageAmount, EDamageType DamageType)
 {
 	if (bIsGhost || IsDestroyed()) return 0.0f;
 
-	// Material resistance
-	float Resistance = 0.0f;
-	switch (PieceData.Material)
-	{
-	case EBuildingMaterial::Bamboo:
-		if (DamageType == EDamageType::Fire) Resistance = -0.5f; // Extra vulnerable to fire
-		break;
-	case EBuildingMaterial::Stone:
-		if (DamageType == EDamageType::Physical) Resistance = 0.5f;
-		if (DamageType == EDamageType::Fire) Resistance = 0.8f;
-		break;
-	case EBuildingMaterial::Iron:
-		if (DamageType == EDamageType::Physical) Resistance = 0.6f;
-		break;
-	case EBuildingMaterial::SpiritForged:
-		Resistance = 0.3f; // Resistant to all damage types
-		break;
-	default:
-		break;
-	}
+	// Material resistance from the compile-time table
+	const float Resistance = YomiBuildingResistance::Get(PieceData.Material, DamageType);
+	return ApplyResolvedDamage(DamageAmount * (1.0f - Resistance));
+}
+
+float AYomiBuildingPiece::ApplyResolvedDamage(float FinalDamage)
+{
+	if (bIsGhost || IsDestroyed() || FinalDamage <= 0.0f) return 0.0f;
 
-	float FinalDamage = DamageAmount * (1.0f - Resistance);
-	CurrentHealth = FMath::Max(0.0f, CurrentHealth - FinalDamage);
+	const float Dealt = FMath::Min(FinalDamage, CurrentHealth);
+	CurrentHealth -= Dealt;
+	MarkHealthDirty(Dealt);
 
 	if (CurrentHealth <= 0.0f)
 	{
 		OnPieceDestroyed();
 	}
 
-	return FinalDamage;
+	return Dealt;
+}
+
+void AYomiBuildingPiece::SetHealthFromBatch(uint8 HealthByte)
+{
+	ReplicatedHealth = HealthByte;
+	OnRep_HealthByte();
 }
 
 void AYomiBuildingPiece::Repair(float Amount)
@@ -89,6 +138,8 @@ void AYomiBuildingPiece::Repair(float Amount)
 	{
 		CurrentHealth = FMath::Min(CurrentHealth + Amount, PieceData.MaxHealth);
 	}
+
+	MarkHealthDirty();
 }
 
 void AYomiBuildingPiece::SetAsGhost(bool bGhost)
@@ -97,6 +148,13 @@ void AYomiBuildingPiece::SetAsGhost(bool bGhost)
 
 	if (bGhost)
 	{
+		UnregisterFromSubsystem();
+
+		// The ghost is a local placement preview, never worth a replication slot
+		// and never allowed to dirty the navmesh as it follows the cursor
+		SetReplicates(false);
+		MeshComponent->SetCanEverAffectNavigation(false);
+
 		SetActorEnableCollision(false);
 		MeshComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 
@@ -108,8 +166,14 @@ void AYomiBuildingPiece::SetAsGhost(bool bGhost)
 	}
 	else
 	{
+		if (HasActorBegunPlay())
+		{
+			RegisterWithSubsystem();
+		}
+
 		SetActorEnableCollision(true);
 		MeshComponent->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+		MeshComponent->SetCanEverAffectNavigation(!bUnderConstruction);
 
 		if (OriginalMaterial)
 		{
@@ -132,6 +196,35 @@ void AYomiBuildingPiece::SetGhostValid(bool bValid)
 	}
 }
 
+void AYomiBuildingPiece::SetUnderConstruction(bool bConstructing)
+{
+	if (bUnderConstruction == bConstructing || bIsGhost) return;
+	bUnderConstruction = bConstructing;
+
+	MeshComponent->SetCanEverAffectNavigation(!bConstructing);
+
+	if (bConstructing)
+	{
+		if (!ConstructionNavModifier)
+		{
+			ConstructionNavModifier = NewObject<UNavModifierComponent>(this, TEXT("ConstructionNavModifier"));
+			ConstructionNavModifier->SetAreaClass(UNavArea_Obstacle::StaticClass());
+			ConstructionNavModifier->FailsafeExtent = PieceData.SnapSize * 0.5f;
+
+			// Deferred spawns register it together with the rest of the actor
+			if (MeshComponent->IsRegistered())
+			{
+				ConstructionNavModifier->RegisterComponent();
+			}
+		}
+	}
+	else if (ConstructionNavModifier)
+	{
+		ConstructionNavModifier->DestroyComponent();
+		ConstructionNavModifier = nullptr;
+	}
+}
+
 TArray<FVector> AYomiBuildingPiece::GetSnapPoints() const
 {
 	TArray<FVector> Points;
@@ -157,11 +250,63 @@ void AYomiBuildingPiece::OnPieceDestroyed()
 	// Play destruction VFX
 	// Drop partial materials
 
+	// Rubble no longer takes part in spatial queries or blocks pathing
+	UnregisterFromSubsystem();
+	MeshComponent->SetCanEverAffectNavigation(false);
+
 	SetLifeSpan(2.0f); // Destroy after animation
 }
 
+void AYomiBuildingPiece::RegisterWithSubsystem()
+{
+	if (UYomiBuildingSubsystem* BuildingSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UYomiBuildingSubsystem>() : nullptr)
+	{
+		BuildingSubsystem->RegisterPiece(this);
+	}
+}
+
+void AYomiBuildingPiece::UnregisterFromSubsystem()
+{
+	if (UYomiBuildingSubsystem* BuildingSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UYomiBuildingSubsystem>() : nullptr)
+	{
+		BuildingSubsystem->UnregisterPiece(this);
+	}
+}
+
+void AYomiBuildingPiece::MarkHealthDirty(float DamageDealt)
+{
+	if (!HasAuthority()) return;
+
+	const float Percent = GetHealthPercent();
+	// Round up so a barely standing piece never replicates as destroyed
+	const uint8 NewByte = static_cast<uint8>(FMath::Clamp(FMath::CeilToInt(Percent * 255.0f), 0, 255));
+	if (NewByte == ReplicatedHealth && CurrentHealth > 0.0f) return;
+
+	ReplicatedHealth = NewByte;
+
+	// Replicate the new byte once, then fall back to dormancy
+	FlushNetDormancy();
+
+	// Listeners (damage numbers, repair effects) hear about the change in one batch per frame
+	if (UYomiBuildingSubsystem* BuildingSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UYomiBuildingSubsystem>() : nullptr)
+	{
+		BuildingSubsystem->QueueHealthUpdate(this, DamageDealt);
+	}
+}
+
+void AYomiBuildingPiece::OnRep_HealthByte()
+{
+	CurrentHealth = PieceData.MaxHealth * (ReplicatedHealth / 255.0f);
+}
+
+void AYomiBuildingPiece::OnRep_PieceID()
+{
+	ResolvePieceData();
+}
+
 void AYomiBuildingPiece::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-	DOREPLIFETIME(AYomiBuildingPiece, CurrentHealth);
+	DOREPLIFETIME(AYomiBuildingPiece, ReplicatedHealth);
+	DOREPLIFETIME_CONDITION(AYomiBuildingPiece, ReplicatedPieceID, COND_InitialOnly);
 }
@@ -0,0 +1,422 @@
+// Copyright (c) 2026 Yomi Survival. All Rights Reserved.
+
+#include "Building/YomiBuildingSubsystem.h"
+#include "Building/YomiBuildingPiece.h"
+#include "Building/YomiBuildingComponent.h"
+#include "Building/YomiBuildingResistance.h"
+#include "Core/YomiGameState.h"
+#include "Engine/World.h"
+#include "NavigationSystem.h"
+
+void UYomiBuildingSubsystem::Deinitialize()
+{
+	PendingBatches.Empty();
+	PieceDefinitions.Empty();
+	PendingHealthUpdates.Empty();
+	PendingHealthIndices.Empty();
+	ReleaseNavigationLock();
+	Super::Deinitialize();
+}
+
+void UYomiBuildingSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (PendingBatches.Num() > 0)
+	{
+		ProcessPendingPlacements();
+	}
+
+	if (PendingHealthUpdates.Num() > 0)
+	{
+		FlushHealthUpdates();
+	}
+
+	if (bNavigationLocked && GetWorld() && GetWorld()->GetTimeSeconds() >= NavigationUnlockTime)
+	{
+		ReleaseNavigationLock();
+	}
+}
+
+// ============================================================================
+// SPATIAL INDEX
+// ============================================================================
+
+FIntVector UYomiBuildingSubsystem::GetCellCoord(const FVector& Location) const
+{
+	return FIntVector(
+		FMath::FloorToInt(Location.X / CellSize),
+		FMath::FloorToInt(Location.Y / CellSize),
+		FMath::FloorToInt(Location.Z / CellSize));
+}
+
+void UYomiBuildingSubsystem::RegisterPiece(AYomiBuildingPiece* Piece)
+{
+	if (!Piece) return;
+
+	// Re-registering moves the piece to its current cell
+	UnregisterPiece(Piece);
+
+	const FIntVector Cell = GetCellCoord(Piece->GetActorLocation());
+	Cells.FindOrAdd(Cell).Add(Piece);
+	PieceCells.Add(Piece, Cell);
+
+	MaxPieceRadius = FMath::Max(MaxPieceRadius, Piece->GetFootprintRadius());
+
+	ShelterField.AddPiece(Piece);
+	DeferNavigationRebuild();
+}
+
+void UYomiBuildingSubsystem::UnregisterPiece(AYomiBuildingPiece* Piece)
+{
+	FIntVector Cell;
+	if (!Piece || !PieceCells.RemoveAndCopyValue(Piece, Cell)) return;
+
+	ShelterField.RemovePiece(Piece);
+	DeferNavigationRebuild();
+
+	if (TArray<TWeakObjectPtr<AYomiBuildingPiece>>* Bucket = Cells.Find(Cell))
+	{
+		Bucket->RemoveSwap(Piece);
+		if (Bucket->Num() == 0)
+		{
+			Cells.Remove(Cell);
+		}
+	}
+}
+
+void UYomiBuildingSubsystem::GatherPiecesInRadius(const FVector& Origin, float Radius, TArray<AYomiBuildingPiece*>& OutPieces) const
+{
+	const float Reach = Radius + MaxPieceRadius;
+	const FIntVector MinCell = GetCellCoord(Origin - FVector(Reach));
+	const FIntVector MaxCell = GetCellCoord(Origin + FVector(Reach));
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+			{
+				const TArray<TWeakObjectPtr<AYomiBuildingPiece>>* Bucket = Cells.Find(FIntVector(X, Y, Z));
+				if (!Bucket) continue;
+
+				for (const TWeakObjectPtr<AYomiBuildingPiece>& WeakPiece : *Bucket)
+				{
+					AYomiBuildingPiece* Piece = WeakPiece.Get();
+					if (!Piece) continue;
+
+					const float PieceReach = Radius + Piece->GetFootprintRadius();
+					if (FVector::DistSquared(Origin, Piece->GetActorLocation()) <= PieceReach * PieceReach)
+					{
+						OutPieces.Add(Piece);
+					}
+				}
+			}
+		}
+	}
+}
+
+bool UYomiBuildingSubsystem::ValidatePlacements(const TArray<FTransform>& Transforms, const TArray<FVector>& SnapSizes, TArray<int32>* OutBlocked) const
+{
+	check(Transforms.Num() == SnapSizes.Num());
+
+	bool bAllFree = true;
+	TArray<AYomiBuildingPiece*> Nearby;
+
+	auto Overlaps = [](const FVector& Location, float SlotSize, const FVector& OtherLocation, const FVector& OtherSnapSize)
+	{
+		const float MinSeparation = FMath::Min(SlotSize, OtherSnapSize.GetMin()) * SlotOverlapFraction;
+		return FVector::DistSquared(Location, OtherLocation) < MinSeparation * MinSeparation;
+	};
+
+	for (int32 Index = 0; Index < Transforms.Num(); ++Index)
+	{
+		const FVector Location = Transforms[Index].GetLocation();
+		const float SlotSize = SnapSizes[Index].GetMin();
+		bool bBlocked = false;
+
+		Nearby.Reset();
+		GatherPiecesInRadius(Location, SlotSize * SlotOverlapFraction, Nearby);
+
+		for (const AYomiBuildingPiece* Other : Nearby)
+		{
+			if (Other->IsGhost() || Other->IsDestroyed()) continue;
+
+			if (Overlaps(Location, SlotSize, Other->GetActorLocation(), Other->GetPieceData().SnapSize))
+			{
+				bBlocked = true;
+				break;
+			}
+		}
+
+		// Earlier slots of the same request
+		for (int32 Prev = 0; Prev < Index && !bBlocked; ++Prev)
+		{
+			bBlocked = Overlaps(Location, SlotSize, Transforms[Prev].GetLocation(), SnapSizes[Prev]);
+		}
+
+		// Slots already paid for but not spawned yet
+		for (const FPlacementBatch& Batch : PendingBatches)
+		{
+			for (int32 Queued = Batch.NextIndex; Queued < Batch.Transforms.Num() && !bBlocked; ++Queued)
+			{
+				bBlocked = Overlaps(Location, SlotSize, Batch.Transforms[Queued].GetLocation(), Batch.PieceData[Queued].SnapSize);
+			}
+		}
+
+		if (bBlocked)
+		{
+			bAllFree = false;
+			if (!OutBlocked) break;
+			OutBlocked->Add(Index);
+		}
+	}
+
+	return bAllFree;
+}
+
+// ============================================================================
+// PIECE DEFINITIONS
+// ============================================================================
+
+void UYomiBuildingSubsystem::AddPieceDefinitions(const TMap<FName, FBuildingPieceData>& Definitions)
+{
+	const int32 NumKnown = PieceDefinitions.Num();
+	PieceDefinitions.Append(Definitions);
+	if (PieceDefinitions.Num() == NumKnown) return;
+
+	// Replicated pieces that arrived before any building component loaded its table
+	TArray<AYomiBuildingPiece*> Pieces;
+	Pieces.Reserve(PieceCells.Num());
+	for (const TPair<TWeakObjectPtr<AYomiBuildingPiece>, FIntVector>& Entry : PieceCells)
+	{
+		if (AYomiBuildingPiece* Piece = Entry.Key.Get())
+		{
+			Pieces.Add(Piece);
+		}
+	}
+
+	// Resolving re-registers the piece, so never do it while iterating the index
+	for (AYomiBuildingPiece* Piece : Pieces)
+	{
+		Piece->ResolvePieceData();
+	}
+}
+
+// ============================================================================
+// BATCHED PLACEMENT
+// ============================================================================
+
+void UYomiBuildingSubsystem::EnqueuePlacementBatch(FName BlueprintID, TArray<FBuildingPieceData>&& PieceData, TArray<FTransform>&& Transforms,
+	AActor* Owner, UYomiBuildingComponent* Requester)
+{
+	check(PieceData.Num() == Transforms.Num());
+	if (PieceData.Num() == 0) return;
+
+	FPlacementBatch& Batch = PendingBatches.AddDefaulted_GetRef();
+	Batch.BlueprintID = BlueprintID;
+	Batch.PieceData = MoveTemp(PieceData);
+	Batch.Transforms = MoveTemp(Transforms);
+	Batch.Owner = Owner;
+	Batch.Requester = Requester;
+	Batch.SpawnedPieces.Reserve(Batch.PieceData.Num());
+}
+
+int32 UYomiBuildingSubsystem::GetNumPendingPlacements() const
+{
+	int32 Count = 0;
+	for (const FPlacementBatch& Batch : PendingBatches)
+	{
+		Count += Batch.PieceData.Num() - Batch.NextIndex;
+	}
+	return Count;
+}
+
+void UYomiBuildingSubsystem::ProcessPendingPlacements()
+{
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	int32 Budget = FMath::Max(1, MaxPiecesSpawnedPerFrame);
+
+	// Oldest batch first so a large house cannot starve a single wall placed after it
+	while (Budget > 0 && PendingBatches.Num() > 0)
+	{
+		FPlacementBatch& Batch = PendingBatches[0];
+
+		while (Budget > 0 && Batch.NextIndex < Batch.PieceData.Num())
+		{
+			const int32 Index = Batch.NextIndex++;
+			--Budget;
+
+			// Deferred so the piece registers and first replicates with its final data
+			AYomiBuildingPiece* Piece = World->SpawnActorDeferred<AYomiBuildingPiece>(
+				AYomiBuildingPiece::StaticClass(), Batch.Transforms[Index], Batch.Owner.Get());
+			if (!Piece) continue;
+
+			Piece->InitializePiece(Batch.PieceData[Index]);
+			Piece->SetUnderConstruction(true);
+			Piece->FinishSpawning(Batch.Transforms[Index]);
+			Batch.SpawnedPieces.Add(Piece);
+		}
+
+		if (Batch.NextIndex < Batch.PieceData.Num()) break;
+
+		TArray<AYomiBuildingPiece*> Spawned;
+		Spawned.Reserve(Batch.SpawnedPieces.Num());
+		for (const TWeakObjectPtr<AYomiBuildingPiece>& WeakPiece : Batch.SpawnedPieces)
+		{
+			if (AYomiBuildingPiece* Piece = WeakPiece.Get())
+			{
+				Spawned.Add(Piece);
+			}
+		}
+
+		const FName BlueprintID = Batch.BlueprintID;
+		const TWeakObjectPtr<UYomiBuildingComponent> Requester = Batch.Requester;
+		PendingBatches.RemoveAt(0);
+
+		// Swap construction modifiers for real geometry in one go, under a single nav batch
+		DeferNavigationRebuild();
+		for (AYomiBuildingPiece* Piece : Spawned)
+		{
+			Piece->SetUnderConstruction(false);
+		}
+
+		if (UYomiBuildingComponent* Component = Requester.Get())
+		{
+			Component->NotifyBlueprintPlaced(BlueprintID, Spawned);
+		}
+	}
+}
+
+// ============================================================================
+// NAVIGATION
+// ============================================================================
+
+void UYomiBuildingSubsystem::DeferNavigationRebuild()
+{
+	if (bNavigationLocked) return;
+
+	// Only the server builds the navmesh that AI paths on
+	UWorld* World = GetWorld();
+	if (!World || World->GetNetMode() == NM_Client) return;
+
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World);
+	if (!NavSys) return;
+
+	// Dirty areas keep accumulating while locked and are processed per tile on release
+	NavSys->AddNavigationBuildLock(ENavigationBuildLock::Custom);
+	bNavigationLocked = true;
+	NavigationUnlockTime = World->GetTimeSeconds() + NavRebuildBatchWindow;
+}
+
+void UYomiBuildingSubsystem::ReleaseNavigationLock()
+{
+	if (!bNavigationLocked) return;
+	bNavigationLocked = false;
+
+	if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+	{
+		// Only the accumulated dirty tiles, never a full rebuild
+		NavSys->RemoveNavigationBuildLock(ENavigationBuildLock::Custom, UNavigationSystemV1::ELockRemovalRebuildAction::NoRebuild);
+	}
+}
+
+// ============================================================================
+// AREA DAMAGE
+// ============================================================================
+
+int32 UYomiBuildingSubsystem::ApplyAreaDamage(FVector Origin, float Radius, float DamageAmount, EDamageType DamageType, bool bLinearFalloff)
+{
+	UWorld* World = GetWorld();
+	if (!World || World->GetNetMode() == NM_Client) return 0;
+	if (DamageAmount <= 0.0f || Radius <= 0.0f) return 0;
+
+	TArray<AYomiBuildingPiece*> Pieces;
+	GatherPiecesInRadius(Origin, Radius, Pieces);
+	if (Pieces.Num() == 0) return 0;
+
+	int32 NumDamaged = 0;
+	const float InvRadius = 1.0f / Radius;
+	for (AYomiBuildingPiece* Piece : Pieces)
+	{
+		if (Piece->IsGhost() || Piece->IsDestroyed()) continue;
+
+		float Scale = 1.0f;
+		if (bLinearFalloff)
+		{
+			Scale = FMath::Clamp(1.0f - FVector::Dist(Origin, Piece->GetActorLocation()) * InvRadius, 0.0f, 1.0f);
+		}
+
+		// Each damaged piece queues itself into this frame's health batch
+		const float Resistance = YomiBuildingResistance::Get(Piece->GetPieceData().Material, DamageType);
+		if (Piece->ApplyResolvedDamage(DamageAmount * Scale * (1.0f - Resistance)) > 0.0f)
+		{
+			NumDamaged++;
+		}
+	}
+
+	if (NumDamaged > 0)
+	{
+		UE_LOG(LogYomiBuilding, Verbose, TEXT("Area damage at %s hit %d building pieces"), *Origin.ToString(), NumDamaged);
+	}
+
+	return NumDamaged;
+}
+
+void UYomiBuildingSubsystem::QueueHealthUpdate(AYomiBuildingPiece* Piece, float DamageDealt)
+{
+	if (!Piece) return;
+
+	// Several hits on one piece in a frame collapse into its latest health
+	if (const int32* ExistingIndex = PendingHealthIndices.Find(Piece))
+	{
+		FYomiBuildingHealthUpdate& Update = PendingHealthUpdates[*ExistingIndex];
+		Update.HealthByte = Piece->GetReplicatedHealthByte();
+		Update.DamageDealt += DamageDealt;
+		return;
+	}
+
+	PendingHealthIndices.Add(Piece, PendingHealthUpdates.Num());
+	FYomiBuildingHealthUpdate& Update = PendingHealthUpdates.AddDefaulted_GetRef();
+	Update.Piece = Piece;
+	Update.HealthByte = Piece->GetReplicatedHealthByte();
+	Update.DamageDealt = DamageDealt;
+}
+
+void UYomiBuildingSubsystem::FlushHealthUpdates()
+{
+	TArray<FYomiBuildingHealthUpdate> Updates = MoveTemp(PendingHealthUpdates);
+	PendingHealthIndices.Reset();
+
+	// Pieces garbage collected since they queued are nulled by the property reference
+	Updates.RemoveAllSwap([](const FYomiBuildingHealthUpdate& Update) { return Update.Piece == nullptr; });
+	if (Updates.Num() == 0) return;
+
+	if (AYomiGameState* GameState = GetWorld() ? GetWorld()->GetGameState<AYomiGameState>() : nullptr)
+	{
+		GameState->MulticastBuildingHealthBatch(Updates);
+	}
+	else
+	{
+		HandleHealthBatch(Updates);
+	}
+}
+
+void UYomiBuildingSubsystem::HandleHealthBatch(const TArray<FYomiBuildingHealthUpdate>& Updates)
+{
+	// The server already applied these values; clients adopt them directly
+	if (GetWorld() && GetWorld()->GetNetMode() == NM_Client)
+	{
+		for (const FYomiBuildingHealthUpdate& Update : Updates)
+		{
+			if (Update.Piece)
+			{
+				Update.Piece->SetHealthFromBatch(Update.HealthByte);
+			}
+		}
+	}
+
+	OnBuildingPiecesDamaged.Broadcast(Updates);
+}
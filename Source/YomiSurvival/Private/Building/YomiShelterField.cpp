@@ -0,0 +1,127 @@
+// Copyright (c) 2026 Yomi Survival. All Rights Reserved.
+
+#include "Building/YomiShelterField.h"
+#include "Building/YomiBuildingPiece.h"
+
+FIntVector FYomiShelterField::ToCell(const FVector& Location)
+{
+	return FIntVector(
+		FMath::FloorToInt(Location.X / CellSize),
+		FMath::FloorToInt(Location.Y / CellSize),
+		FMath::FloorToInt(Location.Z / CellSize));
+}
+
+void FYomiShelterField::AddPiece(const AYomiBuildingPiece* Piece)
+{
+	if (!Piece) return;
+
+	const FBuildingPieceData& Data = Piece->GetPieceData();
+	if (!Data.bProvidesRoof && Data.ComfortBonus <= 0.0f) return;
+
+	// A piece is only ever counted once
+	RemovePiece(Piece);
+
+	FContribution Contribution;
+
+	if (Data.bProvidesRoof)
+	{
+		// Axis-aligned footprint of the rotated roof, projected down the shelter column
+		const FBox Footprint = FBox(-Data.SnapSize * 0.5f, Data.SnapSize * 0.5f).TransformBy(Piece->GetActorTransform());
+		Contribution.bRoof = true;
+		Contribution.RoofMin = ToCell(Footprint.Min);
+		Contribution.RoofMax = ToCell(Footprint.Max);
+		Contribution.RoofMin.Z = Contribution.RoofMax.Z - ShelterDepthCells;
+		ApplyRoof(Contribution, 1);
+	}
+
+	if (Data.ComfortBonus > 0.0f)
+	{
+		Contribution.Comfort = Data.ComfortBonus;
+		Contribution.ComfortCenter = ToCell(Piece->GetActorLocation());
+		ApplyComfort(Contribution, 1.0f);
+	}
+
+	Contributions.Add(Piece, Contribution);
+}
+
+void FYomiShelterField::RemovePiece(const AYomiBuildingPiece* Piece)
+{
+	FContribution Contribution;
+	if (!Piece || !Contributions.RemoveAndCopyValue(Piece, Contribution)) return;
+
+	if (Contribution.bRoof)
+	{
+		ApplyRoof(Contribution, -1);
+	}
+	if (Contribution.Comfort > 0.0f)
+	{
+		ApplyComfort(Contribution, -1.0f);
+	}
+}
+
+float FYomiShelterField::GetComfortAt(const FVector& Location) const
+{
+	const FCell* Cell = Cells.Find(ToCell(Location));
+	return Cell ? Cell->Comfort : 0.0f;
+}
+
+bool FYomiShelterField::IsShelteredAt(const FVector& Location) const
+{
+	const FCell* Cell = Cells.Find(ToCell(Location));
+	return Cell && Cell->RoofCount > 0;
+}
+
+void FYomiShelterField::ApplyRoof(const FContribution& Contribution, int32 Sign)
+{
+	for (int32 X = Contribution.RoofMin.X; X <= Contribution.RoofMax.X; ++X)
+	{
+		for (int32 Y = Contribution.RoofMin.Y; Y <= Contribution.RoofMax.Y; ++Y)
+		{
+			for (int32 Z = Contribution.RoofMin.Z; Z <= Contribution.RoofMax.Z; ++Z)
+			{
+				const FIntVector Coord(X, Y, Z);
+				Cells.FindOrAdd(Coord).RoofCount += Sign;
+				if (Sign < 0)
+				{
+					CompactCell(Coord);
+				}
+			}
+		}
+	}
+}
+
+void FYomiShelterField::ApplyComfort(const FContribution& Contribution, float Sign)
+{
+	const int32 RadiusCells = FMath::CeilToInt(ComfortRadius / CellSize);
+	const int32 RadiusCellsSq = RadiusCells * RadiusCells;
+	const float Delta = Contribution.Comfort * Sign;
+
+	for (int32 DX = -RadiusCells; DX <= RadiusCells; ++DX)
+	{
+		for (int32 DY = -RadiusCells; DY <= RadiusCells; ++DY)
+		{
+			if (DX * DX + DY * DY > RadiusCellsSq) continue;
+
+			for (int32 DZ = -ComfortHeightCells; DZ <= ComfortHeightCells; ++DZ)
+			{
+				const FIntVector Coord = Contribution.ComfortCenter + FIntVector(DX, DY, DZ);
+				Cells.FindOrAdd(Coord).Comfort += Delta;
+				if (Sign < 0.0f)
+				{
+					CompactCell(Coord);
+				}
+			}
+		}
+	}
+}
+
+void FYomiShelterField::CompactCell(const FIntVector& Coord)
+{
+	if (const FCell* Cell = Cells.Find(Coord))
+	{
+		if (Cell->IsEmpty())
+		{
+			Cells.Remove(Coord);
+		}
+	}
+}
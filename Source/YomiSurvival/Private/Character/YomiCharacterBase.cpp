@@ -1,86 +1,263 @@
 // Copyright (c) 2026 Yomi Survival. All Rights Reserved.
 
 #include "Character/YomiCharacterBase.h"
+#include "Character/YomiCharacterRegistry.h"
+#include "Combat/YomiCombatRules.h"
+#include "Combat/YomiLagCompensationSubsystem.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/GameStateBase.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 
 AYomiCharacterBase::AYomiCharacterBase()
 {
 	PrimaryActorTick.bCanEverTick = true;
 	bReplicates = true;
 
-	CurrentHealth = MaxHealth;
-	CurrentStamina = MaxStamina;
+	HealthStat.Value = MaxHealth;
+	StaminaStat.Value = MaxStamina;
 }
 
 void AYomiCharacterBase::BeginPlay()
 {
 	Super::BeginPlay();
-	CurrentHealth = MaxHealth;
-	CurrentStamina = MaxStamina;
+	InitializeAttributes();
+	RebuildResistanceTable();
+
+	// Clients take the anchors as replicated
+	if (HasAuthority())
+	{
+		const float Now = GetRegenTime();
+		HealthStat.Set(MaxHealth, MaxHealth, Now);
+		StaminaStat.Set(MaxStamina, MaxStamina, Now);
+		UpdateRegenRates();
+		MarkHealthDirty();
+		MarkStaminaDirty();
+	}
+
+	if (UYomiCharacterRegistry* Registry = GetWorld()->GetSubsystem<UYomiCharacterRegistry>())
+	{
+		Registry->RegisterCharacter(this);
+	}
+
+	// Hits on this character may be validated against its past positions
+	if (HasAuthority())
+	{
+		if (UYomiLagCompensationSubsystem* LagCompensation = GetWorld()->GetSubsystem<UYomiLagCompensationSubsystem>())
+		{
+			LagCompensation->RegisterCharacter(this);
+		}
+	}
+}
+
+void AYomiCharacterBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UYomiCharacterRegistry* Registry = GetWorld() ? GetWorld()->GetSubsystem<UYomiCharacterRegistry>() : nullptr)
+	{
+		Registry->UnregisterCharacter(this);
+	}
+
+	if (UYomiLagCompensationSubsystem* LagCompensation = GetWorld() ? GetWorld()->GetSubsystem<UYomiLagCompensationSubsystem>() : nullptr)
+	{
+		LagCompensation->UnregisterCharacter(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void AYomiCharacterBase::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
-	if (!IsAlive()) return;
+	// Non-owners see regeneration through the health byte, which only the server can step
+	if (HasAuthority() && HealthStat.IsChanging(GetRegenTime(), MaxHealth))
+	{
+		UpdateReplicatedHealth();
+	}
+
+	// Everything that changed since the last frame, from regeneration, hits or replication, goes out in one round
+	FlushStatNotifications();
+
+	// Sleep until a stat changes again
+	if (!NeedsTick())
+	{
+		SetActorTickEnabled(false);
+	}
+}
+
+bool AYomiCharacterBase::NeedsTick() const
+{
+	if (HealthNotifier.bPending || StaminaNotifier.bPending) return true;
+
+	const float Now = GetRegenTime();
+	const bool bHealthChanging = HealthStat.IsChanging(Now, MaxHealth);
+	if (bHealthChanging && (HasAuthority() || OnHealthChanged.IsBound())) return true;
+	return OnStaminaChanged.IsBound() && StaminaStat.IsChanging(Now, MaxStamina);
+}
+
+void AYomiCharacterBase::RefreshTickEnabled()
+{
+	SetActorTickEnabled(NeedsTick());
+}
+
+void AYomiCharacterBase::QueueStatNotification(FYomiStatNotifier& Notifier)
+{
+	Notifier.bPending = true;
+	SetActorTickEnabled(true);
+}
+
+void AYomiCharacterBase::FlushStatNotifications()
+{
+	const float Now = GetRegenTime();
 
-	// Health regeneration
-	if (CurrentHealth < MaxHealth && HealthRegenRate > 0.0f)
+	// Regeneration never writes the stats, so it is only looked for while something is listening
+	if (OnHealthChanged.IsBound() && HealthStat.IsChanging(Now, MaxHealth))
+	{
+		HealthNotifier.bPending = true;
+	}
+	if (OnStaminaChanged.IsBound() && StaminaStat.IsChanging(Now, MaxStamina))
 	{
-		Heal(HealthRegenRate * DeltaTime);
+		StaminaNotifier.bPending = true;
 	}
 
-	// Stamina regeneration with delay
-	if (StaminaRegenTimer > 0.0f)
+	const float Health = HealthStat.Evaluate(Now, MaxHealth);
+	if (ConsumeStatNotification(HealthNotifier, Health, MaxHealth))
 	{
-		StaminaRegenTimer -= DeltaTime;
+		OnHealthChanged.Broadcast(Health, MaxHealth);
 	}
-	else if (CurrentStamina < MaxStamina)
+
+	const float Stamina = StaminaStat.Evaluate(Now, MaxStamina);
+	if (ConsumeStatNotification(StaminaNotifier, Stamina, MaxStamina))
+	{
+		OnStaminaChanged.Broadcast(Stamina, MaxStamina);
+	}
+}
+
+bool AYomiCharacterBase::ConsumeStatNotification(FYomiStatNotifier& Notifier, float Value, float Max)
+{
+	const float Now = GetWorld()->GetTimeSeconds();
+	if (!Notifier.ShouldSend(Value, Max, StatNotifyQuantum, StatCriticalFraction, StatNotifyInterval, Now))
 	{
-		RestoreStamina(StaminaRegenRate * DeltaTime);
+		// Drifted back to what listeners already have
+		if (Value == Notifier.SentValue && Max == Notifier.SentMax)
+		{
+			Notifier.bPending = false;
+		}
+		return false;
 	}
+
+	Notifier.MarkSent(Value, Max, Now);
+	return true;
+}
+
+float AYomiCharacterBase::GetCurrentHealth() const
+{
+	return HealthStat.Evaluate(GetRegenTime(), MaxHealth);
+}
+
+float AYomiCharacterBase::GetCurrentStamina() const
+{
+	return StaminaStat.Evaluate(GetRegenTime(), MaxStamina);
 }
 
 void AYomiCharacterBase::Heal(float Amount)
 {
 	if (Amount <= 0.0f || !IsAlive()) return;
 
-	CurrentHealth = FMath::Clamp(CurrentHealth + Amount, 0.0f, MaxHealth);
-	OnHealthChanged.Broadcast(CurrentHealth, MaxHealth);
+	const float Now = GetRegenTime();
+	HealthStat.Set(HealthStat.Evaluate(Now, MaxHealth) + Amount, MaxHealth, Now);
+	MarkHealthDirty();
 }
 
 void AYomiCharacterBase::RestoreStamina(float Amount)
 {
 	if (Amount <= 0.0f) return;
 
-	CurrentStamina = FMath::Clamp(CurrentStamina + Amount, 0.0f, MaxStamina);
-	OnStaminaChanged.Broadcast(CurrentStamina, MaxStamina);
+	const float Now = GetRegenTime();
+	StaminaStat.Set(StaminaStat.Evaluate(Now, MaxStamina) + Amount, MaxStamina, Now);
+	MarkStaminaDirty();
 }
 
 bool AYomiCharacterBase::ConsumeStamina(float Amount)
 {
-	if (CurrentStamina < Amount) return false;
+	if (!StaminaStat.Spend(Amount, MaxStamina, GetRegenTime(), StaminaRegenDelay)) return false;
 
-	CurrentStamina = FMath::Max(0.0f, CurrentStamina - Amount);
-	StaminaRegenTimer = StaminaRegenDelay;
-	OnStaminaChanged.Broadcast(CurrentStamina, MaxStamina);
+	MarkStaminaDirty();
 	return true;
 }
 
+float AYomiCharacterBase::GetRegenTime() const
+{
+	const UWorld* World = GetWorld();
+	if (!World) return 0.0f;
+
+	const AGameStateBase* GameState = World->GetGameState();
+	return GameState ? GameState->GetServerWorldTimeSeconds() : World->GetTimeSeconds();
+}
+
+void AYomiCharacterBase::UpdateRegenRates()
+{
+	const float Now = GetRegenTime();
+	const bool bAlive = IsAlive();
+
+	if (HealthStat.SetRate(bAlive ? CalculateHealthRegen() : 0.0f, MaxHealth, Now))
+	{
+		MarkHealthDirty();
+	}
+	if (StaminaStat.SetRate(bAlive ? CalculateStaminaRegen() : 0.0f, MaxStamina, Now))
+	{
+		MarkStaminaDirty();
+	}
+}
+
+void AYomiCharacterBase::MarkHealthDirty()
+{
+	QueueStatNotification(HealthNotifier);
+	MARK_PROPERTY_DIRTY_FROM_NAME(AYomiCharacterBase, HealthStat, this);
+
+	if (HasAuthority())
+	{
+		UpdateReplicatedHealth();
+	}
+}
+
+void AYomiCharacterBase::MarkStaminaDirty()
+{
+	QueueStatNotification(StaminaNotifier);
+	MARK_PROPERTY_DIRTY_FROM_NAME(AYomiCharacterBase, StaminaStat, this);
+}
+
+void AYomiCharacterBase::UpdateReplicatedHealth()
+{
+	const float Health = GetCurrentHealth();
+
+	// Round up so a barely standing character never replicates as dead
+	const uint8 NewByte = MaxHealth > 0.0f ? static_cast<uint8>(FMath::Clamp(FMath::CeilToInt(Health / MaxHealth * 255.0f), 0, 255)) : 0;
+	if (NewByte == ReplicatedHealth) return;
+
+	ReplicatedHealth = NewByte;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AYomiCharacterBase, ReplicatedHealth, this);
+}
+
 float AYomiCharacterBase::ApplyDamage(float DamageAmount, EDamageType DamageType, AActor* DamageCauser)
 {
 	if (!IsAlive() || DamageAmount <= 0.0f) return 0.0f;
 
-	float Resistance = GetDamageResistance(DamageType);
-	float FinalDamage = DamageAmount * (1.0f - Resistance);
+	return ApplyResolvedDamage(DamageAmount * (1.0f - GetDamageResistance(DamageType)), DamageType, DamageCauser);
+}
+
+float AYomiCharacterBase::ApplyResolvedDamage(float FinalDamage, EDamageType DamageType, AActor* DamageCauser)
+{
+	if (!IsAlive()) return 0.0f;
+
 	FinalDamage = FMath::Max(0.0f, FinalDamage);
 
-	CurrentHealth = FMath::Max(0.0f, CurrentHealth - FinalDamage);
-	OnHealthChanged.Broadcast(CurrentHealth, MaxHealth);
+	const float Now = GetRegenTime();
+	HealthStat.Set(HealthStat.Evaluate(Now, MaxHealth) - FinalDamage, MaxHealth, Now);
+	MarkHealthDirty();
 	OnDamageTaken.Broadcast(FinalDamage, DamageType, DamageCauser);
 
-	if (CurrentHealth <= 0.0f)
+	if (!IsAlive())
 	{
 		Die();
 	}
@@ -90,35 +267,286 @@ float AYomiCharacterBase::ApplyDamage(float DamageAmount, EDamageType DamageType
 
 float AYomiCharacterBase::GetDamageResistance(EDamageType DamageType) const
 {
-	if (const float* Resistance = DamageResistances.Find(DamageType))
+	const int32 Index = static_cast<int32>(DamageType);
+	return Index < NumDamageTypes ? ResistanceTable[Index] : 0.0f;
+}
+
+void AYomiCharacterBase::SetDamageResistance(EDamageType DamageType, float Resistance)
+{
+	DamageResistances.Add(DamageType, Resistance);
+	RebuildResistanceTable();
+}
+
+void AYomiCharacterBase::RebuildResistanceTable()
+{
+	// Defense from armor and buffs stacks on the authored resistances, up to the usual cap
+	const float PhysicalDefense = YomiCombatRules::DefenseToResistance(GetAttribute(EYomiAttribute::PhysicalDefense));
+	const float SpiritDefense = YomiCombatRules::DefenseToResistance(GetAttribute(EYomiAttribute::SpiritDefense));
+
+	for (int32 Index = 0; Index < NumDamageTypes; ++Index)
+	{
+		const float* Authored = DamageResistances.Find(static_cast<EDamageType>(Index));
+		float Resistance = Authored ? *Authored : 0.0f;
+
+		if (Index == static_cast<int32>(EDamageType::Physical))
+		{
+			Resistance += PhysicalDefense;
+		}
+		else if (Index == static_cast<int32>(EDamageType::Spirit))
+		{
+			Resistance += SpiritDefense;
+		}
+
+		ResistanceTable[Index] = YomiCombatRules::ClampResistance(Resistance);
+	}
+}
+
+void AYomiCharacterBase::InitializeAttributes()
+{
+	AttributeBase[static_cast<int32>(EYomiAttribute::MaxHealth)] = MaxHealth;
+	AttributeBase[static_cast<int32>(EYomiAttribute::MaxStamina)] = MaxStamina;
+	AttributeBase[static_cast<int32>(EYomiAttribute::StaminaRegen)] = StaminaRegenRate;
+	AttributeBase[static_cast<int32>(EYomiAttribute::MoveSpeed)] = 1.0f;
+	AttributeBase[static_cast<int32>(EYomiAttribute::Damage)] = 1.0f;
+
+	// Nothing is modified yet, so the cache starts out equal to the bases
+	for (int32 Index = 0; Index < NumAttributes; ++Index)
+	{
+		AttributeValues[Index] = AttributeBase[Index];
+	}
+	DirtyAttributes = 0;
+}
+
+void AYomiCharacterBase::SetModifierLayer(EYomiModifierSource Source, const FYomiModifierLayer& Layer)
+{
+	const int32 SourceIndex = static_cast<int32>(Source);
+	if (SourceIndex >= NumModifierSources) return;
+
+	FYomiModifierLayer& Current = ModifierLayers[SourceIndex];
+	for (int32 Index = 0; Index < NumAttributes; ++Index)
+	{
+		if (Current.Additive[Index] != Layer.Additive[Index] || Current.Multiplier[Index] != Layer.Multiplier[Index])
+		{
+			DirtyAttributes |= 1u << Index;
+		}
+	}
+
+	Current = Layer;
+	RefreshAttributes();
+}
+
+void AYomiCharacterBase::ClearModifierLayer(EYomiModifierSource Source)
+{
+	SetModifierLayer(Source, FYomiModifierLayer());
+}
+
+void AYomiCharacterBase::SetAttributeBase(EYomiAttribute Attribute, float Value)
+{
+	const int32 Index = static_cast<int32>(Attribute);
+	if (Index >= NumAttributes || AttributeBase[Index] == Value) return;
+
+	AttributeBase[Index] = Value;
+	DirtyAttributes |= 1u << Index;
+	RefreshAttributes();
+}
+
+void AYomiCharacterBase::SetMaxHealth(float NewMaxHealth)
+{
+	if (!HasAuthority()) return;
+	SetAttributeBase(EYomiAttribute::MaxHealth, NewMaxHealth);
+}
+
+void AYomiCharacterBase::SetMaxStamina(float NewMaxStamina)
+{
+	if (!HasAuthority()) return;
+	SetAttributeBase(EYomiAttribute::MaxStamina, NewMaxStamina);
+}
+
+void AYomiCharacterBase::RefreshAttributes()
+{
+	while (DirtyAttributes != 0)
+	{
+		const int32 Index = FMath::CountTrailingZeros(DirtyAttributes);
+		DirtyAttributes &= DirtyAttributes - 1;
+
+		float Additive = 0.0f;
+		float Multiplier = 0.0f;
+		for (const FYomiModifierLayer& Layer : ModifierLayers)
+		{
+			Additive += Layer.Additive[Index];
+			Multiplier += Layer.Multiplier[Index];
+		}
+
+		const float NewValue = FMath::Max(0.0f, (AttributeBase[Index] + Additive) * (1.0f + Multiplier));
+		if (NewValue == AttributeValues[Index]) continue;
+
+		AttributeValues[Index] = NewValue;
+
+		const EYomiAttribute Attribute = static_cast<EYomiAttribute>(Index);
+		ApplyAttribute(Attribute, NewValue);
+		OnAttributeChanged.Broadcast(Attribute, NewValue);
+	}
+}
+
+void AYomiCharacterBase::ApplyAttribute(EYomiAttribute Attribute, float Value)
+{
+	switch (Attribute)
 	{
-		return FMath::Clamp(*Resistance, 0.0f, 0.9f); // Cap at 90% resistance
+	case EYomiAttribute::MaxHealth:
+		ApplyMaxHealth(Value);
+		break;
+	case EYomiAttribute::MaxStamina:
+		ApplyMaxStamina(Value);
+		break;
+	case EYomiAttribute::StaminaRegen:
+		StaminaRegenRate = Value;
+		UpdateRegenRates();
+		break;
+	case EYomiAttribute::MoveSpeed:
+		MoveSpeedScale = Value;
+		ApplyMoveSpeedScale();
+		break;
+	case EYomiAttribute::PhysicalDefense:
+	case EYomiAttribute::SpiritDefense:
+		RebuildResistanceTable();
+		break;
+	default:
+		// Damage is read straight from the cache when a hit is calculated
+		break;
 	}
-	return 0.0f;
+}
+
+void AYomiCharacterBase::ApplyMaxHealth(float Value)
+{
+	// Re-anchor under the old cap so regeneration so far is kept, then clamp to the new one
+	const float Now = GetRegenTime();
+	HealthStat.Set(HealthStat.Evaluate(Now, MaxHealth), Value, Now);
+	MaxHealth = Value;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AYomiCharacterBase, MaxHealth, this);
+	MarkHealthDirty();
+}
+
+void AYomiCharacterBase::ApplyMaxStamina(float Value)
+{
+	const float Now = GetRegenTime();
+	StaminaStat.Set(StaminaStat.Evaluate(Now, MaxStamina), Value, Now);
+	MaxStamina = Value;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AYomiCharacterBase, MaxStamina, this);
+	MarkStaminaDirty();
+}
+
+void AYomiCharacterBase::ApplyMoveSpeedScale()
+{
+	const float NewScale = FMath::Max(MoveSpeedScale, KINDA_SMALL_NUMBER);
+	if (FMath::IsNearlyEqual(NewScale, AppliedMoveSpeedScale)) return;
+
+	// Rescale rather than overwrite, so sprinting, enrage and the like keep their own multipliers
+	GetCharacterMovement()->MaxWalkSpeed *= NewScale / AppliedMoveSpeedScale;
+	AppliedMoveSpeedScale = NewScale;
+}
+
+void AYomiCharacterBase::SetStatusEffects(TArrayView<const FYomiStatusEffectIcon> Icons, float SpeedScale)
+{
+	ActiveStatusEffects.Reset();
+	ActiveStatusEffects.Append(Icons.GetData(), Icons.Num());
+
+	FYomiModifierLayer Layer;
+	Layer.Add(EYomiAttribute::MoveSpeed, 0.0f, SpeedScale - 1.0f);
+	SetModifierLayer(EYomiModifierSource::StatusEffect, Layer);
+
+	OnStatusEffectsChanged.Broadcast(ActiveStatusEffects);
 }
 
 void AYomiCharacterBase::Die()
 {
+	UpdateRegistryAliveState();
+
+	// The dead do not regenerate
+	UpdateRegenRates();
+
+	// Listeners see the empty bar before the death, not a frame after
+	FlushStatNotifications();
 	OnDeath.Broadcast();
 	UE_LOG(LogYomi, Log, TEXT("%s has died."), *GetName());
 }
 
-void AYomiCharacterBase::OnRep_CurrentHealth()
+void AYomiCharacterBase::UpdateRegistryAliveState()
+{
+	if (UYomiCharacterRegistry* Registry = GetWorld() ? GetWorld()->GetSubsystem<UYomiCharacterRegistry>() : nullptr)
+	{
+		Registry->SetCharacterAlive(this, IsAlive());
+	}
+}
+
+void AYomiCharacterBase::OnRep_HealthStat()
 {
-	OnHealthChanged.Broadcast(CurrentHealth, MaxHealth);
+	UpdateRegistryAliveState();
+	QueueStatNotification(HealthNotifier);
 }
 
-void AYomiCharacterBase::OnRep_CurrentStamina()
+void AYomiCharacterBase::OnRep_HealthByte()
 {
-	OnStaminaChanged.Broadcast(CurrentStamina, MaxStamina);
+	if (!HasNetOwner())
+	{
+		ApplyReplicatedHealth();
+	}
+}
+
+void AYomiCharacterBase::OnRep_MaxHealth()
+{
+	// The byte is relative to the maximum, so a new maximum moves the health it stands for
+	if (!HasNetOwner())
+	{
+		ApplyReplicatedHealth();
+	}
+	QueueStatNotification(HealthNotifier);
+}
+
+void AYomiCharacterBase::ApplyReplicatedHealth()
+{
+	HealthStat.Set(MaxHealth * (ReplicatedHealth / 255.0f), MaxHealth, GetRegenTime());
+	HealthStat.Rate = 0.0f;
+	UpdateRegistryAliveState();
+	QueueStatNotification(HealthNotifier);
+}
+
+void AYomiCharacterBase::OnRep_StaminaStat()
+{
+	QueueStatNotification(StaminaNotifier);
+}
+
+void AYomiCharacterBase::OnRep_ActiveStatusEffects()
+{
+	OnStatusEffectsChanged.Broadcast(ActiveStatusEffects);
+}
+
+void AYomiCharacterBase::OnRep_MoveSpeedScale()
+{
+	// The owning client predicts its own movement and must agree with the server's speed
+	ApplyMoveSpeedScale();
 }
 
 void AYomiCharacterBase::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME(AYomiCharacterBase, CurrentHealth);
-	DOREPLIFETIME(AYomiCharacterBase, MaxHealth);
-	DOREPLIFETIME(AYomiCharacterBase, CurrentStamina);
-	DOREPLIFETIME(AYomiCharacterBase, MaxStamina);
+	// Vitals are push-based: they are only compared when something marked them dirty
+	FDoRepLifetimeParams PushParams;
+	PushParams.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(AYomiCharacterBase, MaxHealth, PushParams);
+
+	FDoRepLifetimeParams OwnerParams;
+	OwnerParams.Condition = COND_OwnerOnly;
+	OwnerParams.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(AYomiCharacterBase, HealthStat, OwnerParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AYomiCharacterBase, StaminaStat, OwnerParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AYomiCharacterBase, MaxStamina, OwnerParams);
+
+	FDoRepLifetimeParams OthersParams;
+	OthersParams.Condition = COND_SkipOwner;
+	OthersParams.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(AYomiCharacterBase, ReplicatedHealth, OthersParams);
+
+	DOREPLIFETIME_CONDITION(AYomiCharacterBase, ActiveStatusEffects, COND_OwnerOnly);
+	DOREPLIFETIME_CONDITION(AYomiCharacterBase, MoveSpeedScale, COND_OwnerOnly);
 }
@@ -0,0 +1,271 @@
+// Copyright (c) 2026 Yomi Survival. All Rights Reserved.
+
+#include "Character/YomiCharacterRegistry.h"
+#include "Character/YomiCharacterBase.h"
+
+void UYomiCharacterRegistry::Deinitialize()
+{
+	Entries.Empty();
+	EntryIndices.Empty();
+	Cells.Empty();
+	Super::Deinitialize();
+}
+
+void UYomiCharacterRegistry::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	constexpr float MoveThresholdSq = MoveThreshold * MoveThreshold;
+
+	for (int32 Index = Entries.Num() - 1; Index >= 0; --Index)
+	{
+		FEntry& Entry = Entries[Index];
+		const AYomiCharacterBase* Character = Entry.Character.Get();
+		if (!Character)
+		{
+			RemoveEntryAt(Index);
+			continue;
+		}
+
+		const FVector Location = Character->GetActorLocation();
+		if (FVector::DistSquared(Location, Entry.FiledLocation) <= MoveThresholdSq) continue;
+
+		Entry.FiledLocation = Location;
+		const FIntVector NewCell = GetCellCoord(Location);
+		if (NewCell != Entry.Cell)
+		{
+			RemoveFromCell(Index);
+			Entry.Cell = NewCell;
+			AddToCell(Index);
+		}
+	}
+}
+
+// ============================================================================
+// REGISTRATION
+// ============================================================================
+
+FIntVector UYomiCharacterRegistry::GetCellCoord(const FVector& Location) const
+{
+	return FIntVector(
+		FMath::FloorToInt(Location.X / CellSize),
+		FMath::FloorToInt(Location.Y / CellSize),
+		FMath::FloorToInt(Location.Z / CellSize));
+}
+
+void UYomiCharacterRegistry::RegisterCharacter(AYomiCharacterBase* Character)
+{
+	if (!Character) return;
+
+	UnregisterCharacter(Character);
+
+	const int32 Index = Entries.AddDefaulted();
+	FEntry& Entry = Entries[Index];
+	Entry.Character = Character;
+	Entry.Key = Character;
+	Entry.FiledLocation = Character->GetActorLocation();
+	Entry.Cell = GetCellCoord(Entry.FiledLocation);
+	Entry.Team = Character->GetTeam();
+	Entry.KindBit = FYomiCharacterFilter::KindBit(Character->GetCharacterKind());
+	Entry.bAlive = Character->IsAlive();
+
+	EntryIndices.Add(Character, Index);
+	AddToCell(Index);
+}
+
+void UYomiCharacterRegistry::UnregisterCharacter(AYomiCharacterBase* Character)
+{
+	if (const int32* Index = EntryIndices.Find(Character))
+	{
+		RemoveEntryAt(*Index);
+	}
+}
+
+void UYomiCharacterRegistry::SetCharacterAlive(AYomiCharacterBase* Character, bool bAlive)
+{
+	if (const int32* Index = EntryIndices.Find(Character))
+	{
+		Entries[*Index].bAlive = bAlive;
+	}
+}
+
+bool UYomiCharacterRegistry::AreAllied(EYomiTeam A, EYomiTeam B)
+{
+	if (A == EYomiTeam::None || B == EYomiTeam::None) return false;
+	if (A == B) return true;
+
+	const bool bAIsPlayerSide = A == EYomiTeam::Players || A == EYomiTeam::Companions;
+	const bool bBIsPlayerSide = B == EYomiTeam::Players || B == EYomiTeam::Companions;
+	return bAIsPlayerSide && bBIsPlayerSide;
+}
+
+void UYomiCharacterRegistry::AddToCell(int32 EntryIndex)
+{
+	Cells.FindOrAdd(Entries[EntryIndex].Cell).Add(EntryIndex);
+}
+
+void UYomiCharacterRegistry::RemoveFromCell(int32 EntryIndex)
+{
+	const FIntVector Cell = Entries[EntryIndex].Cell;
+	if (TArray<int32>* Bucket = Cells.Find(Cell))
+	{
+		Bucket->RemoveSingleSwap(EntryIndex);
+		if (Bucket->Num() == 0)
+		{
+			Cells.Remove(Cell);
+		}
+	}
+}
+
+void UYomiCharacterRegistry::RemoveEntryAt(int32 EntryIndex)
+{
+	RemoveFromCell(EntryIndex);
+	EntryIndices.Remove(Entries[EntryIndex].Key);
+
+	// Swap the last entry into the hole and repoint its cell and key at the new index
+	const int32 LastIndex = Entries.Num() - 1;
+	if (EntryIndex != LastIndex)
+	{
+		const FEntry& Moved = Entries[LastIndex];
+		if (TArray<int32>* Bucket = Cells.Find(Moved.Cell))
+		{
+			const int32 Slot = Bucket->Find(LastIndex);
+			if (Slot != INDEX_NONE)
+			{
+				(*Bucket)[Slot] = EntryIndex;
+			}
+		}
+		EntryIndices.Add(Moved.Key, EntryIndex);
+	}
+
+	Entries.RemoveAtSwap(EntryIndex);
+}
+
+// ============================================================================
+// QUERIES
+// ============================================================================
+
+bool UYomiCharacterRegistry::PassesFilter(const FEntry& Entry, const FYomiCharacterFilter& Filter) const
+{
+	if (Filter.bAliveOnly && !Entry.bAlive) return false;
+	if ((Entry.KindBit & Filter.KindMask) == 0) return false;
+	if (Filter.ExcludeAlliesOf != EYomiTeam::None && AreAllied(Filter.ExcludeAlliesOf, Entry.Team)) return false;
+	return true;
+}
+
+template<typename FunctorType>
+void UYomiCharacterRegistry::ForEachInRadius(const FVector& Origin, float Radius, const FYomiCharacterFilter& Filter, FunctorType&& Visit) const
+{
+	const float RadiusSq = Radius * Radius;
+
+	// Filed locations may lag the real ones, so widen the cell range by the move threshold
+	const float Reach = Radius + MoveThreshold;
+	const FIntVector MinCell = GetCellCoord(Origin - FVector(Reach));
+	const FIntVector MaxCell = GetCellCoord(Origin + FVector(Reach));
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+			{
+				const TArray<int32>* Bucket = Cells.Find(FIntVector(X, Y, Z));
+				if (!Bucket) continue;
+
+				for (const int32 Index : *Bucket)
+				{
+					const FEntry& Entry = Entries[Index];
+					if (!PassesFilter(Entry, Filter)) continue;
+
+					AYomiCharacterBase* Character = Entry.Character.Get();
+					if (!Character || Character == Filter.IgnoreActor) continue;
+
+					const FVector Location = Character->GetActorLocation();
+					const float DistSq = FVector::DistSquared(Origin, Location);
+					if (DistSq <= RadiusSq)
+					{
+						Visit(Character, Location, DistSq);
+					}
+				}
+			}
+		}
+	}
+}
+
+void UYomiCharacterRegistry::GatherInRadius(const FVector& Origin, float Radius, const FYomiCharacterFilter& Filter, TArray<AYomiCharacterBase*>& OutCharacters) const
+{
+	ForEachInRadius(Origin, Radius, Filter, [&OutCharacters](AYomiCharacterBase* Character, const FVector&, float)
+	{
+		OutCharacters.Add(Character);
+	});
+}
+
+void UYomiCharacterRegistry::GatherInCone(const FVector& Origin, const FVector& Direction, float Radius, float HalfAngleDegrees,
+	const FYomiCharacterFilter& Filter, TArray<AYomiCharacterBase*>& OutCharacters) const
+{
+	const FVector Axis = Direction.GetSafeNormal();
+	const float CosHalfAngle = FMath::Cos(FMath::DegreesToRadians(FMath::Clamp(HalfAngleDegrees, 0.0f, 180.0f)));
+	const float CosSq = CosHalfAngle * CosHalfAngle;
+
+	ForEachInRadius(Origin, Radius, Filter, [&](AYomiCharacterBase* Character, const FVector& Location, float DistSq)
+	{
+		// Compare dot(Axis, V) against cos * |V| in squared form to avoid the square root
+		const float Dot = FVector::DotProduct(Axis, Location - Origin);
+		const bool bInside = CosHalfAngle >= 0.0f
+			? (Dot >= 0.0f && Dot * Dot >= CosSq * DistSq)
+			: (Dot >= 0.0f || Dot * Dot <= CosSq * DistSq);
+
+		if (bInside)
+		{
+			OutCharacters.Add(Character);
+		}
+	});
+}
+
+void UYomiCharacterRegistry::FindNearest(const FVector& Origin, float Radius, int32 Count, const FYomiCharacterFilter& Filter, TArray<AYomiCharacterBase*>& OutCharacters) const
+{
+	if (Count <= 0) return;
+
+	// Sorted by distance, never longer than Count
+	TArray<TPair<float, AYomiCharacterBase*>, TInlineAllocator<8>> Best;
+
+	ForEachInRadius(Origin, Radius, Filter, [&Best, Count](AYomiCharacterBase* Character, const FVector&, float DistSq)
+	{
+		if (Best.Num() == Count && DistSq >= Best.Last().Key) return;
+
+		int32 Insert = Best.Num();
+		while (Insert > 0 && Best[Insert - 1].Key > DistSq)
+		{
+			--Insert;
+		}
+		Best.Insert(TPair<float, AYomiCharacterBase*>(DistSq, Character), Insert);
+
+		if (Best.Num() > Count)
+		{
+			Best.Pop(EAllowShrinking::No);
+		}
+	});
+
+	OutCharacters.Reserve(OutCharacters.Num() + Best.Num());
+	for (const TPair<float, AYomiCharacterBase*>& Pair : Best)
+	{
+		OutCharacters.Add(Pair.Value);
+	}
+}
+
+AYomiCharacterBase* UYomiCharacterRegistry::FindNearestCharacter(const FVector& Origin, float Radius, const FYomiCharacterFilter& Filter) const
+{
+	AYomiCharacterBase* Nearest = nullptr;
+	float NearestDistSq = TNumericLimits<float>::Max();
+
+	ForEachInRadius(Origin, Radius, Filter, [&Nearest, &NearestDistSq](AYomiCharacterBase* Character, const FVector&, float DistSq)
+	{
+		if (DistSq < NearestDistSq)
+		{
+			NearestDistSq = DistSq;
+			Nearest = Character;
+		}
+	});
+
+	return Nearest;
+}
@@ -8,9 +8,14 @@
 #include "EnhancedInputSubsystems.h"
 #include "Inventory/YomiInventoryComponent.h"
 #include "Combat/YomiCombatComponent.h"
+#include "Combat/YomiCombatRules.h"
 #include "Building/YomiBuildingComponent.h"
 #include "AI/YomiCompanion.h"
+#include "Core/YomiDataSubsystem.h"
+#include "Engine/GameInstance.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
+#include "TimerManager.h"
 
 AYomiPlayerCharacter::AYomiPlayerCharacter()
 {
@@ -48,8 +53,10 @@ AYomiPlayerCharacter::AYomiPlayerCharacter()
 	// Default stats
 	MaxHealth = 100.0f;
 	MaxStamina = 100.0f;
-	CurrentKi = 50.0f;
 	MaxKi = 50.0f;
+	KiStat.Value = MaxKi;
+
+	Team = EYomiTeam::Players;
 }
 
 void AYomiPlayerCharacter::BeginPlay()
@@ -74,24 +81,22 @@ void AYomiPlayerCharacter::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
-	// Ki regeneration
-	if (CurrentKi < MaxKi)
+	// Sprint stamina drain, as a rate that only changes when the player starts or stops moving
+	const bool bShouldDrain = bIsSprinting && GetCharacterMovement()->Velocity.SizeSquared() > 0.0f;
+	if (bShouldDrain != bSprintDraining)
 	{
-		float RegenRate = KiRegenRate;
-		if (bIsMeditating)
+		bSprintDraining = bShouldDrain;
+		if (!bSprintDraining)
 		{
-			RegenRate *= MeditationKiRegenMultiplier;
+			StaminaStat.RegenStartTime = GetRegenTime() + StaminaRegenDelay;
+			MarkStaminaDirty();
 		}
-		RestoreKi(RegenRate * DeltaTime);
+		UpdateRegenRates();
 	}
 
-	// Sprint stamina drain
-	if (bIsSprinting && GetCharacterMovement()->Velocity.SizeSquared() > 0.0f)
+	if (bSprintDraining && GetCurrentStamina() <= 0.0f)
 	{
-		if (!ConsumeStamina(SprintStaminaCost * DeltaTime))
-		{
-			StopSprint();
-		}
+		StopSprint();
 	}
 
 	// Dodge cooldown
@@ -101,14 +106,7 @@ void AYomiPlayerCharacter::Tick(float DeltaTime)
 	}
 
 	// Food buff tick
-	TickFoodBuffs(DeltaTime);
-
-	// Meditation healing
-	if (bIsMeditating)
-	{
-		Heal(HealthRegenRate * 3.0f * DeltaTime);
-		RestoreStamina(StaminaRegenRate * 2.0f * DeltaTime);
-	}
+	TickFoodBuffs();
 }
 
 void AYomiPlayerCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
@@ -194,33 +192,37 @@ void AYomiPlayerCharacter::Look(const FInputActionValue& Value)
 
 void AYomiPlayerCharacter::StartSprint()
 {
-	if (CurrentStamina > 0.0f && !bIsMeditating)
+	if (GetCurrentStamina() > 0.0f && !bIsMeditating)
 	{
 		bIsSprinting = true;
-		GetCharacterMovement()->MaxWalkSpeed = BaseWalkSpeed * SprintSpeedMultiplier;
+		GetCharacterMovement()->MaxWalkSpeed = BaseWalkSpeed * SprintSpeedMultiplier * AppliedMoveSpeedScale;
 	}
 }
 
 void AYomiPlayerCharacter::StopSprint()
 {
 	bIsSprinting = false;
-	GetCharacterMovement()->MaxWalkSpeed = BaseWalkSpeed;
+	GetCharacterMovement()->MaxWalkSpeed = BaseWalkSpeed * AppliedMoveSpeedScale;
 }
 
 void AYomiPlayerCharacter::DodgeRoll()
 {
-	if (DodgeCooldownTimer > 0.0f || bIsMeditating) return;
-	if (!ConsumeStamina(DodgeStaminaCost)) return;
+	if (DodgeCooldownTimer > 0.0f || bIsMeditating || !CombatComponent) return;
+
+	// Dodge in movement direction; the combat component predicts it and has the server confirm
+	CombatComponent->PerformAction(EYomiPredictedAction::DodgeRoll, GetLastMovementInputVector().GetSafeNormal2D());
+}
+
+bool AYomiPlayerCharacter::PerformDodgeRoll(const FVector& Direction, float Tolerance)
+{
+	if (DodgeCooldownTimer > Tolerance) return false;
+	if (!ConsumeStamina(DodgeStaminaCost)) return false;
 
 	DodgeCooldownTimer = DodgeCooldown;
 
-	// Launch character in movement direction
-	FVector DodgeDirection = GetLastMovementInputVector();
-	if (DodgeDirection.IsNearlyZero())
-	{
-		DodgeDirection = GetActorForwardVector();
-	}
+	const FVector DodgeDirection = Direction.IsNearlyZero() ? GetActorForwardVector() : Direction;
 	LaunchCharacter(DodgeDirection * 800.0f + FVector(0, 0, 100.0f), true, true);
+	return true;
 }
 
 void AYomiPlayerCharacter::ToggleBuildMode()
@@ -298,20 +300,128 @@ void AYomiPlayerCharacter::UseSpecialAbility()
 // KI SYSTEM
 // ============================================================================
 
+float AYomiPlayerCharacter::GetCurrentKi() const
+{
+	return KiStat.Evaluate(GetRegenTime(), MaxKi);
+}
+
 bool AYomiPlayerCharacter::ConsumeKi(float Amount)
 {
-	if (CurrentKi < Amount) return false;
+	const float Now = GetRegenTime();
+	const float Ki = KiStat.Evaluate(Now, MaxKi);
+	if (Ki < Amount) return false;
 
-	CurrentKi = FMath::Max(0.0f, CurrentKi - Amount);
-	OnKiChanged.Broadcast(CurrentKi, MaxKi);
+	KiStat.Set(Ki - Amount, MaxKi, Now);
+	MarkKiDirty();
 	return true;
 }
 
 void AYomiPlayerCharacter::RestoreKi(float Amount)
 {
 	if (Amount <= 0.0f) return;
-	CurrentKi = FMath::Clamp(CurrentKi + Amount, 0.0f, MaxKi);
-	OnKiChanged.Broadcast(CurrentKi, MaxKi);
+
+	const float Now = GetRegenTime();
+	KiStat.Set(KiStat.Evaluate(Now, MaxKi) + Amount, MaxKi, Now);
+	MarkKiDirty();
+}
+
+void AYomiPlayerCharacter::MarkKiDirty()
+{
+	QueueStatNotification(KiNotifier);
+	MARK_PROPERTY_DIRTY_FROM_NAME(AYomiPlayerCharacter, KiStat, this);
+}
+
+void AYomiPlayerCharacter::OnRep_KiStat()
+{
+	// Keep predicted spends the server has not confirmed yet instead of bouncing back for a round trip
+	if (CombatComponent)
+	{
+		KiStat.Value = FMath::Max(0.0f, KiStat.Value - CombatComponent->GetUnconfirmedKiSpend());
+	}
+	QueueStatNotification(KiNotifier);
+}
+
+void AYomiPlayerCharacter::FlushStatNotifications()
+{
+	Super::FlushStatNotifications();
+
+	const float Now = GetRegenTime();
+	if (OnKiChanged.IsBound() && KiStat.IsChanging(Now, MaxKi))
+	{
+		KiNotifier.bPending = true;
+	}
+
+	const float Ki = KiStat.Evaluate(Now, MaxKi);
+	if (ConsumeStatNotification(KiNotifier, Ki, MaxKi))
+	{
+		OnKiChanged.Broadcast(Ki, MaxKi);
+	}
+}
+
+void AYomiPlayerCharacter::UpdateRegenRates()
+{
+	Super::UpdateRegenRates();
+
+	float KiRate = 0.0f;
+	if (IsAlive())
+	{
+		KiRate = bIsMeditating ? KiRegenRate * MeditationKiRegenMultiplier : KiRegenRate;
+	}
+	if (KiStat.SetRate(KiRate, MaxKi, GetRegenTime()))
+	{
+		MarkKiDirty();
+	}
+}
+
+float AYomiPlayerCharacter::CalculateHealthRegen() const
+{
+	float Rate = Super::CalculateHealthRegen();
+	if (bIsMeditating)
+	{
+		Rate += HealthRegenRate * 3.0f;
+	}
+
+	return Rate + FoodHealthRegen;
+}
+
+float AYomiPlayerCharacter::CalculateStaminaRegen() const
+{
+	// Sprinting holds off natural regeneration; food keeps working
+	float Rate = bSprintDraining ? -SprintStaminaCost : Super::CalculateStaminaRegen();
+	if (bIsMeditating)
+	{
+		Rate += StaminaRegenRate * 2.0f;
+	}
+
+	return Rate + FoodStaminaRegen;
+}
+
+void AYomiPlayerCharacter::InitializeAttributes()
+{
+	Super::InitializeAttributes();
+
+	AttributeBase[static_cast<int32>(EYomiAttribute::KiRegen)] = KiRegenRate;
+	AttributeValues[static_cast<int32>(EYomiAttribute::KiRegen)] = KiRegenRate;
+}
+
+void AYomiPlayerCharacter::ApplyAttribute(EYomiAttribute Attribute, float Value)
+{
+	if (Attribute == EYomiAttribute::KiRegen)
+	{
+		KiRegenRate = Value;
+		UpdateRegenRates();
+		return;
+	}
+	Super::ApplyAttribute(Attribute, Value);
+}
+
+void AYomiPlayerCharacter::OnRep_StaminaStat()
+{
+	if (CombatComponent)
+	{
+		StaminaStat.Value = FMath::Max(0.0f, StaminaStat.Value - CombatComponent->GetUnconfirmedStaminaSpend());
+	}
+	Super::OnRep_StaminaStat();
 }
 
 // ============================================================================
@@ -322,6 +432,7 @@ void AYomiPlayerCharacter::AddHonor(float Amount)
 {
 	HonorPoints += Amount;
 	UpdateHonorLevel();
+	MARK_PROPERTY_DIRTY_FROM_NAME(AYomiPlayerCharacter, HonorPoints, this);
 	OnHonorChanged.Broadcast(HonorPoints, CurrentHonorLevel);
 }
 
@@ -329,6 +440,7 @@ void AYomiPlayerCharacter::RemoveHonor(float Amount)
 {
 	HonorPoints = FMath::Max(0.0f, HonorPoints - Amount);
 	UpdateHonorLevel();
+	MARK_PROPERTY_DIRTY_FROM_NAME(AYomiPlayerCharacter, HonorPoints, this);
 	OnHonorChanged.Broadcast(HonorPoints, CurrentHonorLevel);
 }
 
@@ -347,6 +459,8 @@ void AYomiPlayerCharacter::OnDishonorableAction()
 
 void AYomiPlayerCharacter::UpdateHonorLevel()
 {
+	const EHonorLevel PreviousLevel = CurrentHonorLevel;
+
 	if (HonorPoints >= 1000.0f) CurrentHonorLevel = EHonorLevel::Ascendant;
 	else if (HonorPoints >= 700.0f) CurrentHonorLevel = EHonorLevel::Legend;
 	else if (HonorPoints >= 500.0f) CurrentHonorLevel = EHonorLevel::Champion;
@@ -354,6 +468,12 @@ void AYomiPlayerCharacter::UpdateHonorLevel()
 	else if (HonorPoints >= 100.0f) CurrentHonorLevel = EHonorLevel::Warrior;
 	else if (HonorPoints >= 0.0f) CurrentHonorLevel = EHonorLevel::Ronin;
 	else CurrentHonorLevel = EHonorLevel::Dishonored;
+
+	// The rank is public, so it is only sent when it actually moves
+	if (CurrentHonorLevel != PreviousLevel)
+	{
+		MARK_PROPERTY_DIRTY_FROM_NAME(AYomiPlayerCharacter, CurrentHonorLevel, this);
+	}
 }
 
 // ============================================================================
@@ -373,13 +493,19 @@ bool AYomiPlayerCharacter::ConsumeFood(const FFoodData& FoodData)
 	RestoreStamina(FoodData.StaminaRestore);
 	RestoreKi(FoodData.KiRestore);
 
-	// Add buff if it has a duration
-	if (FoodData.BuffDuration > 0.0f)
+	// Add buff if it has a duration; its bonuses are read back from the food database by type
+	if (FoodData.BuffDuration > 0.0f && FoodData.FoodType != EFoodType::None)
 	{
 		FActiveFoodBuff NewBuff;
-		NewBuff.FoodData = FoodData;
-		NewBuff.RemainingDuration = FoodData.BuffDuration;
-		ActiveFoodBuffs.Add(NewBuff);
+		NewBuff.Food = FoodData.FoodType;
+		NewBuff.ExpiryTime = GetWorld()->GetTimeSeconds() + FoodData.BuffDuration;
+
+		int32 Index = 0;
+		while (Index < ActiveFoodBuffs.Num() && ActiveFoodBuffs[Index].ExpiryTime > NewBuff.ExpiryTime)
+		{
+			++Index;
+		}
+		ActiveFoodBuffs.Insert(NewBuff, Index);
 		RecalculateFoodBonuses();
 	}
 
@@ -387,29 +513,15 @@ bool AYomiPlayerCharacter::ConsumeFood(const FFoodData& FoodData)
 	return true;
 }
 
-void AYomiPlayerCharacter::TickFoodBuffs(float DeltaTime)
+void AYomiPlayerCharacter::TickFoodBuffs()
 {
-	bool bNeedsRecalculate = false;
+	const float Now = GetWorld()->GetTimeSeconds();
 
-	for (int32 i = ActiveFoodBuffs.Num() - 1; i >= 0; --i)
+	bool bNeedsRecalculate = false;
+	while (ActiveFoodBuffs.Num() > 0 && ActiveFoodBuffs.Last().ExpiryTime <= Now)
 	{
-		ActiveFoodBuffs[i].RemainingDuration -= DeltaTime;
-
-		// Apply per-second regen from buffs
-		if (ActiveFoodBuffs[i].FoodData.HealthRegenRate > 0.0f)
-		{
-			Heal(ActiveFoodBuffs[i].FoodData.HealthRegenRate * DeltaTime);
-		}
-		if (ActiveFoodBuffs[i].FoodData.StaminaRegenRate > 0.0f)
-		{
-			RestoreStamina(ActiveFoodBuffs[i].FoodData.StaminaRegenRate * DeltaTime);
-		}
-
-		if (ActiveFoodBuffs[i].RemainingDuration <= 0.0f)
-		{
-			ActiveFoodBuffs.RemoveAt(i);
-			bNeedsRecalculate = true;
-		}
+		ActiveFoodBuffs.Pop(EAllowShrinking::No);
+		bNeedsRecalculate = true;
 	}
 
 	if (bNeedsRecalculate)
@@ -420,27 +532,55 @@ void AYomiPlayerCharacter::TickFoodBuffs(float DeltaTime)
 
 void AYomiPlayerCharacter::RecalculateFoodBonuses()
 {
-	// Remove old bonuses
-	MaxHealth -= FoodHealthBonus;
-	MaxStamina -= FoodStaminaBonus;
+	const UGameInstance* GameInstance = GetGameInstance();
+	const UYomiDataSubsystem* Data = GameInstance ? GameInstance->GetSubsystem<UYomiDataSubsystem>() : nullptr;
 
-	// Recalculate
-	FoodHealthBonus = 0.0f;
-	FoodStaminaBonus = 0.0f;
-	FoodDamageBonus = 0.0f;
-	FoodDefenseBonus = 0.0f;
+	// Damage and defense bonuses are fractions, e.g. 0.05 for +5%. Defense is added as flat points, so it helps without armor too.
+	FYomiModifierLayer Layer;
+	FoodHealthRegen = 0.0f;
+	FoodStaminaRegen = 0.0f;
 
 	for (const FActiveFoodBuff& Buff : ActiveFoodBuffs)
 	{
-		FoodHealthBonus += Buff.FoodData.MaxHealthBonus;
-		FoodStaminaBonus += Buff.FoodData.MaxStaminaBonus;
-		FoodDamageBonus += Buff.FoodData.DamageBonus;
-		FoodDefenseBonus += Buff.FoodData.DefenseBonus;
+		const FFoodData* FoodData = Data ? Data->FindFoodData(Buff.Food) : nullptr;
+		if (!FoodData) continue;
+
+		Layer.Add(EYomiAttribute::MaxHealth, FoodData->MaxHealthBonus);
+		Layer.Add(EYomiAttribute::MaxStamina, FoodData->MaxStaminaBonus);
+		Layer.Add(EYomiAttribute::Damage, 0.0f, FoodData->DamageBonus);
+		Layer.Add(EYomiAttribute::PhysicalDefense, YomiCombatRules::DefenseBonusToDefense(FoodData->DefenseBonus));
+		Layer.Add(EYomiAttribute::SpiritDefense, YomiCombatRules::DefenseBonusToDefense(FoodData->DefenseBonus));
+
+		FoodHealthRegen += FMath::Max(0.0f, FoodData->HealthRegenRate);
+		FoodStaminaRegen += FMath::Max(0.0f, FoodData->StaminaRegenRate);
 	}
 
-	// Apply new bonuses
-	MaxHealth += FoodHealthBonus;
-	MaxStamina += FoodStaminaBonus;
+	SetModifierLayer(EYomiModifierSource::Food, Layer);
+
+	// Per-second regen from buffs is part of the regeneration rates
+	UpdateRegenRates();
+}
+
+// ============================================================================
+// BLESSINGS
+// ============================================================================
+
+void AYomiPlayerCharacter::ReceiveBlessing(const FYomiModifierLayer& Blessing, float Duration)
+{
+	if (Duration <= 0.0f) return;
+
+	SetModifierLayer(EYomiModifierSource::Blessing, Blessing);
+	GetWorldTimerManager().SetTimer(BlessingTimerHandle, this, &AYomiPlayerCharacter::EndBlessing, Duration, false);
+}
+
+bool AYomiPlayerCharacter::IsBlessed() const
+{
+	return GetWorldTimerManager().IsTimerActive(BlessingTimerHandle);
+}
+
+void AYomiPlayerCharacter::EndBlessing()
+{
+	ClearModifierLayer(EYomiModifierSource::Blessing);
 }
 
 // ============================================================================
@@ -452,6 +592,7 @@ void AYomiPlayerCharacter::StartMeditation()
 	if (GetCharacterMovement()->Velocity.SizeSquared() > 1.0f) return;
 
 	bIsMeditating = true;
+	UpdateRegenRates();
 	GetCharacterMovement()->DisableMovement();
 	UE_LOG(LogYomi, Log, TEXT("Started meditation. Ki regen x%f"), MeditationKiRegenMultiplier);
 }
@@ -459,6 +600,7 @@ void AYomiPlayerCharacter::StartMeditation()
 void AYomiPlayerCharacter::StopMeditation()
 {
 	bIsMeditating = false;
+	UpdateRegenRates();
 	GetCharacterMovement()->SetMovementMode(MOVE_Walking);
 	UE_LOG(LogYomi, Log, TEXT("Stopped meditation."));
 }
@@ -617,8 +759,14 @@ void AYomiPlayerCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>&
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME(AYomiPlayerCharacter, CurrentKi);
-	DOREPLIFETIME(AYomiPlayerCharacter, MaxKi);
-	DOREPLIFETIME(AYomiPlayerCharacter, HonorPoints);
-	DOREPLIFETIME(AYomiPlayerCharacter, CurrentHonorLevel);
+	FDoRepLifetimeParams OwnerParams;
+	OwnerParams.Condition = COND_OwnerOnly;
+	OwnerParams.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(AYomiPlayerCharacter, KiStat, OwnerParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AYomiPlayerCharacter, MaxKi, OwnerParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AYomiPlayerCharacter, HonorPoints, OwnerParams);
+
+	FDoRepLifetimeParams PushParams;
+	PushParams.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(AYomiPlayerCharacter, CurrentHonorLevel, PushParams);
 }
@@ -0,0 +1,138 @@
+// Copyright (c) 2026 Yomi Survival. All Rights Reserved.
+
+#include "Combat/YomiAimSubsystem.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Solve Aim Batch"), STAT_YomiSolveAim, STATGROUP_Game);
+
+void UYomiAimSubsystem::Deinitialize()
+{
+	Shooters.Empty();
+	ShooterKeys.Empty();
+	Targets.Empty();
+	Speeds.Empty();
+	GravityScales.Empty();
+	MuzzleOffsets.Empty();
+	Directions.Empty();
+	FlightTimes.Empty();
+	ShooterIndices.Empty();
+	Batch.Reset();
+	Super::Deinitialize();
+}
+
+void UYomiAimSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Shooters.Num() == 0) return;
+
+	SCOPE_CYCLE_COUNTER(STAT_YomiSolveAim);
+
+	for (int32 Index = Shooters.Num() - 1; Index >= 0; --Index)
+	{
+		if (!Shooters[Index].IsValid() || !Targets[Index].IsValid())
+		{
+			RemoveShooterAt(Index);
+		}
+	}
+
+	// Batch indices match shooter indices, since every live shooter adds exactly one entry
+	const float GravityZ = GetWorld()->GetGravityZ();
+	Batch.Reset();
+	for (int32 Index = 0; Index < Shooters.Num(); ++Index)
+	{
+		const AActor* Target = Targets[Index].Get();
+		const FVector Muzzle = Shooters[Index]->GetActorTransform().TransformPosition(MuzzleOffsets[Index]);
+		const FVector Offset = Target->GetActorLocation() - Muzzle;
+		Batch.Add(Offset, Target->GetVelocity(), Speeds[Index], GravityZ * GravityScales[Index]);
+	}
+
+	YomiBallistics::SolveInterceptBatch(Batch);
+
+	for (int32 Index = 0; Index < Shooters.Num(); ++Index)
+	{
+		Directions[Index] = Batch.GetDirection(Index);
+		FlightTimes[Index] = Batch.TimeOfFlight[Index];
+	}
+}
+
+void UYomiAimSubsystem::TrackTarget(AActor* Shooter, AActor* Target, float Speed, float GravityScale, const FVector& MuzzleOffset)
+{
+	if (!Shooter || !Target || Speed <= 0.0f) return;
+
+	int32 Index = FindShooter(Shooter);
+	if (Index == INDEX_NONE)
+	{
+		Index = Shooters.Add(Shooter);
+		ShooterKeys.Add(Shooter);
+		Targets.AddDefaulted();
+		Speeds.AddDefaulted();
+		GravityScales.AddDefaulted();
+		MuzzleOffsets.AddDefaulted();
+		Directions.Add(FVector::ZeroVector);
+
+		// Unsolved until the next tick
+		FlightTimes.Add(-1.0f);
+		ShooterIndices.Add(Shooter, Index);
+	}
+
+	Targets[Index] = Target;
+	Speeds[Index] = Speed;
+	GravityScales[Index] = GravityScale;
+	MuzzleOffsets[Index] = MuzzleOffset;
+}
+
+void UYomiAimSubsystem::StopTracking(const AActor* Shooter)
+{
+	const int32 Index = FindShooter(Shooter);
+	if (Index != INDEX_NONE)
+	{
+		RemoveShooterAt(Index);
+	}
+}
+
+bool UYomiAimSubsystem::GetAimSolution(const AActor* Shooter, FVector& OutDirection, float& OutTimeOfFlight) const
+{
+	const int32 Index = FindShooter(Shooter);
+	if (Index == INDEX_NONE || FlightTimes[Index] <= 0.0f) return false;
+
+	OutDirection = Directions[Index];
+	OutTimeOfFlight = FlightTimes[Index];
+	return true;
+}
+
+FVector UYomiAimSubsystem::GetMuzzleLocation(const AActor* Shooter) const
+{
+	if (!Shooter) return FVector::ZeroVector;
+
+	const int32 Index = FindShooter(Shooter);
+	const FVector MuzzleOffset = Index != INDEX_NONE ? MuzzleOffsets[Index] : FVector::ZeroVector;
+	return Shooter->GetActorTransform().TransformPosition(MuzzleOffset);
+}
+
+int32 UYomiAimSubsystem::FindShooter(const AActor* Shooter) const
+{
+	const int32* Index = ShooterIndices.Find(Shooter);
+	return Index ? *Index : INDEX_NONE;
+}
+
+void UYomiAimSubsystem::RemoveShooterAt(int32 Index)
+{
+	ShooterIndices.Remove(ShooterKeys[Index]);
+
+	// The last shooter is swapped into the hole; repoint its key
+	const int32 LastIndex = Shooters.Num() - 1;
+	if (Index != LastIndex)
+	{
+		ShooterIndices.Add(ShooterKeys[LastIndex], Index);
+	}
+
+	Shooters.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	ShooterKeys.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Targets.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Speeds.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	GravityScales.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	MuzzleOffsets.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Directions.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	FlightTimes.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
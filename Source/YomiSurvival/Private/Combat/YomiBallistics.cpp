@@ -0,0 +1,96 @@
+// Copyright (c) 2026 Yomi Survival. All Rights Reserved.
+
+#include "Combat/YomiBallistics.h"
+#include "Math/VectorRegister.h"
+
+void YomiBallistics::SolveInterceptBatch(FInterceptBatch& Batch)
+{
+	const int32 Count = Batch.Num();
+	Batch.DirectionX.SetNumUninitialized(Count);
+	Batch.DirectionY.SetNumUninitialized(Count);
+	Batch.DirectionZ.SetNumUninitialized(Count);
+	Batch.TimeOfFlight.SetNumUninitialized(Count);
+
+	const VectorRegister4Float Zero = VectorZeroFloat();
+	const VectorRegister4Float Tiny = VectorSetFloat1(KINDA_SMALL_NUMBER);
+	const VectorRegister4Float NegativeTiny = VectorSetFloat1(-KINDA_SMALL_NUMBER);
+	const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+	const VectorRegister4Float Quarter = VectorSetFloat1(0.25f);
+	const VectorRegister4Float Four = VectorSetFloat1(4.0f);
+	const VectorRegister4Float Invalid = VectorSetFloat1(-1.0f);
+
+	// Same steps as SolveIntercept, one shooter per lane; lanes that fail are masked out instead of branching
+	const int32 VectorCount = Count & ~3;
+	for (int32 Base = 0; Base < VectorCount; Base += 4)
+	{
+		const VectorRegister4Float OffsetX = VectorLoad(&Batch.OffsetX[Base]);
+		const VectorRegister4Float OffsetY = VectorLoad(&Batch.OffsetY[Base]);
+		const VectorRegister4Float OffsetZ = VectorLoad(&Batch.OffsetZ[Base]);
+		const VectorRegister4Float VelocityX = VectorLoad(&Batch.VelocityX[Base]);
+		const VectorRegister4Float VelocityY = VectorLoad(&Batch.VelocityY[Base]);
+		const VectorRegister4Float VelocityZ = VectorLoad(&Batch.VelocityZ[Base]);
+		const VectorRegister4Float Speed = VectorLoad(&Batch.Speed[Base]);
+		const VectorRegister4Float GravityZ = VectorLoad(&Batch.GravityZ[Base]);
+
+		const VectorRegister4Float SpeedSq = VectorMultiply(Speed, Speed);
+		const VectorRegister4Float A = VectorMultiply(Quarter, VectorMultiply(GravityZ, GravityZ));
+		const VectorRegister4Float TwoA = VectorMax(VectorAdd(A, A), Tiny);
+		const VectorRegister4Float HasGravity = VectorCompareGE(A, Tiny);
+
+		VectorRegister4Float Valid = VectorCompareGT(Speed, Zero);
+
+		const VectorRegister4Float DistanceSq = VectorMultiplyAdd(OffsetX, OffsetX, VectorMultiplyAdd(OffsetY, OffsetY, VectorMultiply(OffsetZ, OffsetZ)));
+		VectorRegister4Float Time = VectorDivide(VectorSqrt(DistanceSq), VectorMax(Speed, Tiny));
+
+		VectorRegister4Float AimX = OffsetX;
+		VectorRegister4Float AimY = OffsetY;
+		VectorRegister4Float AimZ = OffsetZ;
+
+		for (int32 Iteration = 0; Iteration < InterceptIterations; ++Iteration)
+		{
+			AimX = VectorMultiplyAdd(VelocityX, Time, OffsetX);
+			AimY = VectorMultiplyAdd(VelocityY, Time, OffsetY);
+			AimZ = VectorMultiplyAdd(VelocityZ, Time, OffsetZ);
+
+			const VectorRegister4Float B = VectorNegate(VectorMultiplyAdd(AimZ, GravityZ, SpeedSq));
+			const VectorRegister4Float C = VectorMultiplyAdd(AimX, AimX, VectorMultiplyAdd(AimY, AimY, VectorMultiply(AimZ, AimZ)));
+			const VectorRegister4Float Discriminant = VectorNegateMultiplyAdd(VectorMultiply(Four, A), C, VectorMultiply(B, B));
+
+			const VectorRegister4Float ArcTimeSq = VectorDivide(VectorSubtract(VectorNegate(B), VectorSqrt(VectorMax(Discriminant, Zero))), TwoA);
+			const VectorRegister4Float FlatTimeSq = VectorDivide(VectorNegate(C), VectorMin(B, NegativeTiny));
+			const VectorRegister4Float TimeSq = VectorSelect(HasGravity, ArcTimeSq, FlatTimeSq);
+
+			const VectorRegister4Float Reachable = VectorSelect(HasGravity, VectorCompareGE(Discriminant, Zero), VectorCompareLT(B, Zero));
+			Valid = VectorBitwiseAnd(Valid, VectorBitwiseAnd(Reachable, VectorCompareGT(TimeSq, Zero)));
+
+			Time = VectorSqrt(VectorMax(TimeSq, Tiny));
+		}
+
+		const VectorRegister4Float InvTime = VectorDivide(VectorOneFloat(), Time);
+		const VectorRegister4Float LaunchX = VectorMultiply(AimX, InvTime);
+		const VectorRegister4Float LaunchY = VectorMultiply(AimY, InvTime);
+		const VectorRegister4Float LaunchZ = VectorNegateMultiplyAdd(VectorMultiply(Half, GravityZ), Time, VectorMultiply(AimZ, InvTime));
+
+		const VectorRegister4Float LengthSq = VectorMultiplyAdd(LaunchX, LaunchX, VectorMultiplyAdd(LaunchY, LaunchY, VectorMultiply(LaunchZ, LaunchZ)));
+		const VectorRegister4Float InvLength = VectorReciprocalSqrt(VectorMax(LengthSq, Tiny));
+
+		VectorStore(VectorSelect(Valid, VectorMultiply(LaunchX, InvLength), Zero), &Batch.DirectionX[Base]);
+		VectorStore(VectorSelect(Valid, VectorMultiply(LaunchY, InvLength), Zero), &Batch.DirectionY[Base]);
+		VectorStore(VectorSelect(Valid, VectorMultiply(LaunchZ, InvLength), Zero), &Batch.DirectionZ[Base]);
+		VectorStore(VectorSelect(Valid, Time, Invalid), &Batch.TimeOfFlight[Base]);
+	}
+
+	for (int32 Index = VectorCount; Index < Count; ++Index)
+	{
+		FVector Direction = FVector::ZeroVector;
+		float Time = -1.0f;
+		SolveIntercept(FVector(Batch.OffsetX[Index], Batch.OffsetY[Index], Batch.OffsetZ[Index]),
+			FVector(Batch.VelocityX[Index], Batch.VelocityY[Index], Batch.VelocityZ[Index]),
+			Batch.Speed[Index], Batch.GravityZ[Index], Direction, Time);
+
+		Batch.DirectionX[Index] = Direction.X;
+		Batch.DirectionY[Index] = Direction.Y;
+		Batch.DirectionZ[Index] = Direction.Z;
+		Batch.TimeOfFlight[Index] = Time;
+	}
+}
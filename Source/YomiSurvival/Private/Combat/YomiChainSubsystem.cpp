@@ -0,0 +1,390 @@
+// Copyright (c) 2026 Yomi Survival. All Rights Reserved.
+
+#include "Combat/YomiChainSubsystem.h"
+#include "Combat/YomiChainWeapon.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Simulate Chains"), STAT_YomiSimulateChains, STATGROUP_Game);
+
+void UYomiChainSubsystem::Deinitialize()
+{
+	Positions.Empty();
+	PreviousPositions.Empty();
+	Chains.Empty();
+	FreeSlots.Empty();
+	Hits.Empty();
+	RetractedSlots.Empty();
+	InstanceTransforms.Empty();
+	Super::Deinitialize();
+}
+
+void UYomiChainSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (GetNumActiveChains() == 0) return;
+
+	SCOPE_CYCLE_COUNTER(STAT_YomiSimulateChains);
+
+	const float StepTime = FMath::Min(DeltaTime, MaxStepTime);
+	if (StepTime <= 0.0f) return;
+
+	const float GravityZ = GetWorld()->GetGravityZ();
+	const bool bRenderVisuals = ShouldRenderVisuals();
+
+	Hits.Reset();
+	RetractedSlots.Reset();
+
+	for (int32 Slot = 0; Slot < Chains.Num(); ++Slot)
+	{
+		FChain& Chain = Chains[Slot];
+		if (!Chain.bActive) continue;
+
+		if (!Chain.Owner.IsValid())
+		{
+			ReleaseChain(Slot);
+			continue;
+		}
+
+		Integrate(Slot, StepTime, GravityZ);
+		SolveConstraints(Slot);
+		SweepChain(Slot);
+
+		if (bRenderVisuals)
+		{
+			UpdateVisuals(Slot);
+		}
+
+		if (Chain.bReelingIn && Chain.LinkLength <= MinLinkLength)
+		{
+			RetractedSlots.Add(Slot);
+		}
+	}
+
+	// Owners may attach, reel or release their chain in response, so nothing is stepped past this point
+	for (const FChainHit& ChainHit : Hits)
+	{
+		if (IsActiveChain(ChainHit.Slot) && Chains[ChainHit.Slot].Owner.Get() == ChainHit.Owner)
+		{
+			ChainHit.Owner->HandleChainHit(ChainHit.Hit, ChainHit.LinkStart, ChainHit.LinkEnd, ChainHit.bHead);
+		}
+	}
+
+	for (const int32 Slot : RetractedSlots)
+	{
+		if (!IsActiveChain(Slot)) continue;
+
+		if (AYomiChainWeapon* Owner = Chains[Slot].Owner.Get())
+		{
+			Owner->HandleChainRetracted();
+		}
+	}
+}
+
+// ============================================================================
+// CHAINS
+// ============================================================================
+
+int32 UYomiChainSubsystem::AcquireChain(AYomiChainWeapon* Owner, int32 NumLinks, float LinkLength, float PayOutRate, UInstancedStaticMeshComponent* LinkInstances)
+{
+	if (!Owner || NumLinks < 1) return INDEX_NONE;
+
+	int32 Slot;
+	if (FreeSlots.Num() > 0)
+	{
+		Slot = FreeSlots.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		Slot = Chains.AddDefaulted();
+		Positions.AddZeroed(MaxParticles);
+		PreviousPositions.AddZeroed(MaxParticles);
+	}
+
+	FChain& Chain = Chains[Slot];
+	Chain = FChain();
+	Chain.Owner = Owner;
+	Chain.Instances = LinkInstances;
+	Chain.NumParticles = FMath::Min(NumLinks + 1, MaxParticles);
+	Chain.TargetLinkLength = FMath::Max(LinkLength, MinLinkLength);
+	Chain.ReelRate = PayOutRate;
+	Chain.bActive = true;
+
+	// Starts coiled in the hand and pays out as the head flies
+	const FVector Anchor = Owner->GetChainAnchor();
+	const int32 Start = BlockStart(Slot);
+	for (int32 Index = Start; Index < Start + Chain.NumParticles; ++Index)
+	{
+		Positions[Index] = Anchor;
+		PreviousPositions[Index] = Anchor;
+	}
+
+	return Slot;
+}
+
+void UYomiChainSubsystem::ReleaseChain(int32 Slot)
+{
+	if (!IsActiveChain(Slot)) return;
+
+	UInstancedStaticMeshComponent* Instances = Chains[Slot].Instances.Get();
+	if (Instances && Instances->GetInstanceCount() > 0)
+	{
+		Instances->ClearInstances();
+	}
+
+	Chains[Slot] = FChain();
+	FreeSlots.Add(Slot);
+}
+
+void UYomiChainSubsystem::LaunchHead(int32 Slot, const FVector& Velocity)
+{
+	if (!IsActiveChain(Slot)) return;
+
+	Chains[Slot].PendingHeadVelocity = Velocity;
+	Chains[Slot].bHasPendingLaunch = true;
+}
+
+void UYomiChainSubsystem::AttachHead(int32 Slot, USceneComponent* Parent, FName Bone, const FVector& WorldLocation)
+{
+	if (!IsActiveChain(Slot) || !Parent) return;
+
+	FChain& Chain = Chains[Slot];
+	Chain.HeadParent = Parent;
+	Chain.HeadBone = Bone;
+	Chain.HeadOffset = FTransform(WorldLocation).GetRelativeTransform(Parent->GetSocketTransform(Bone));
+	Chain.bHeadAttached = true;
+	Chain.bHasPendingLaunch = false;
+
+	const int32 Head = BlockStart(Slot) + Chain.NumParticles - 1;
+	Positions[Head] = WorldLocation;
+	PreviousPositions[Head] = WorldLocation;
+}
+
+void UYomiChainSubsystem::DetachHead(int32 Slot)
+{
+	if (!IsActiveChain(Slot)) return;
+
+	FChain& Chain = Chains[Slot];
+	Chain.HeadParent.Reset();
+	Chain.HeadBone = NAME_None;
+	Chain.bHeadAttached = false;
+
+	// Drops from where it was instead of flying off with the target's last motion
+	const int32 Head = BlockStart(Slot) + Chain.NumParticles - 1;
+	PreviousPositions[Head] = Positions[Head];
+}
+
+void UYomiChainSubsystem::ReelIn(int32 Slot, float Rate)
+{
+	if (!IsActiveChain(Slot)) return;
+
+	FChain& Chain = Chains[Slot];
+	Chain.TargetLinkLength = MinLinkLength;
+	Chain.ReelRate = Rate;
+	Chain.bReelingIn = true;
+}
+
+void UYomiChainSubsystem::SetSweep(int32 Slot, bool bSweepPawns, bool bLinksSweep, float LinkRadius, float HeadRadius)
+{
+	if (!IsActiveChain(Slot)) return;
+
+	FChain& Chain = Chains[Slot];
+	Chain.bSweepPawns = bSweepPawns;
+	Chain.bLinksSweep = bLinksSweep;
+	Chain.LinkRadius = LinkRadius;
+	Chain.HeadRadius = HeadRadius;
+}
+
+FVector UYomiChainSubsystem::GetHeadLocation(int32 Slot) const
+{
+	if (!IsActiveChain(Slot)) return FVector::ZeroVector;
+	return Positions[BlockStart(Slot) + Chains[Slot].NumParticles - 1];
+}
+
+TConstArrayView<FVector> UYomiChainSubsystem::GetParticles(int32 Slot) const
+{
+	if (!IsActiveChain(Slot)) return TConstArrayView<FVector>();
+	return TConstArrayView<FVector>(Positions.GetData() + BlockStart(Slot), Chains[Slot].NumParticles);
+}
+
+// ============================================================================
+// SIMULATION
+// ============================================================================
+
+void UYomiChainSubsystem::Integrate(int32 Slot, float DeltaTime, float GravityZ)
+{
+	FChain& Chain = Chains[Slot];
+	const int32 Start = BlockStart(Slot);
+	const int32 Head = Start + Chain.NumParticles - 1;
+
+	Chain.LinkLength = FMath::FInterpConstantTo(Chain.LinkLength, Chain.TargetLinkLength, DeltaTime, Chain.ReelRate);
+
+	// Position Verlet: the velocity is implied by the last two positions
+	const FVector GravityStep(0.0f, 0.0f, GravityZ * DeltaTime * DeltaTime);
+	for (int32 Index = Start + 1; Index <= Head; ++Index)
+	{
+		const FVector Current = Positions[Index];
+		Positions[Index] += (Current - PreviousPositions[Index]) * Damping + GravityStep;
+		PreviousPositions[Index] = Current;
+	}
+
+	if (Chain.bHasPendingLaunch)
+	{
+		Positions[Head] = PreviousPositions[Head] + Chain.PendingHeadVelocity * DeltaTime;
+		Chain.bHasPendingLaunch = false;
+	}
+
+	PreviousPositions[Start] = Positions[Start];
+	Positions[Start] = Chain.Owner->GetChainAnchor();
+
+	if (Chain.bHeadAttached)
+	{
+		if (const USceneComponent* Parent = Chain.HeadParent.Get())
+		{
+			Positions[Head] = (Chain.HeadOffset * Parent->GetSocketTransform(Chain.HeadBone)).GetLocation();
+		}
+		else
+		{
+			Chain.bHeadAttached = false;
+		}
+	}
+}
+
+void UYomiChainSubsystem::SolveConstraints(int32 Slot)
+{
+	const FChain& Chain = Chains[Slot];
+	const int32 Start = BlockStart(Slot);
+	const int32 Head = Start + Chain.NumParticles - 1;
+	const float RestLength = Chain.LinkLength;
+
+	// The hand is pinned, and so is the head once it has latched on to something
+	const float HeadWeight = Chain.bHeadAttached ? 0.0f : HeadInverseMass;
+
+	for (int32 Iteration = 0; Iteration < SolverIterations; ++Iteration)
+	{
+		for (int32 Index = Start; Index < Head; ++Index)
+		{
+			const float WeightA = Index == Start ? 0.0f : 1.0f;
+			const float WeightB = Index + 1 == Head ? HeadWeight : 1.0f;
+			const float TotalWeight = WeightA + WeightB;
+			if (TotalWeight <= 0.0f) continue;
+
+			const FVector Delta = Positions[Index + 1] - Positions[Index];
+			const float Length = Delta.Size();
+			if (Length < KINDA_SMALL_NUMBER) continue;
+
+			const FVector Correction = Delta * ((Length - RestLength) / (Length * TotalWeight));
+			Positions[Index] += Correction * WeightA;
+			Positions[Index + 1] -= Correction * WeightB;
+		}
+	}
+}
+
+void UYomiChainSubsystem::SweepChain(int32 Slot)
+{
+	FChain& Chain = Chains[Slot];
+	AYomiChainWeapon* Owner = Chain.Owner.Get();
+	UWorld* World = GetWorld();
+
+	const int32 Start = BlockStart(Slot);
+	const int32 Head = Start + Chain.NumParticles - 1;
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(YomiChainSweep), false, Owner);
+	Params.AddIgnoredActor(Owner->GetWeaponOwner());
+
+	// The head stops on walls everywhere the chain exists, so grapples agree between client and server
+	if (!Chain.bHeadAttached)
+	{
+		FCollisionObjectQueryParams HeadObjects(ECC_WorldStatic);
+		HeadObjects.AddObjectTypesToQuery(ECC_WorldDynamic);
+		if (Chain.bSweepPawns)
+		{
+			HeadObjects.AddObjectTypesToQuery(ECC_Pawn);
+		}
+
+		FHitResult Hit;
+		if (World->SweepSingleByObjectType(Hit, PreviousPositions[Head], Positions[Head], FQuat::Identity, HeadObjects,
+			FCollisionShape::MakeSphere(Chain.HeadRadius), Params))
+		{
+			Positions[Head] = Hit.Location;
+			PreviousPositions[Head] = Hit.Location;
+
+			FChainHit& ChainHit = Hits.AddDefaulted_GetRef();
+			ChainHit.Slot = Slot;
+			ChainHit.Owner = Owner;
+			ChainHit.LinkStart = Positions[Head - 1];
+			ChainHit.LinkEnd = Hit.Location;
+			ChainHit.bHead = true;
+			ChainHit.Hit = Hit;
+		}
+	}
+
+	if (!Chain.bSweepPawns || !Chain.bLinksSweep) return;
+
+	// Each link sweeps as a capsule from where it was last frame, like a blade sub-step
+	const FCollisionObjectQueryParams LinkObjects(ECC_Pawn);
+	TArray<FHitResult> LinkHits;
+
+	for (int32 Index = Start; Index < Head; ++Index)
+	{
+		const FVector Link = Positions[Index + 1] - Positions[Index];
+		const float LinkLength = Link.Size();
+		if (LinkLength < KINDA_SMALL_NUMBER) continue;
+
+		const FCollisionShape Capsule = FCollisionShape::MakeCapsule(Chain.LinkRadius, LinkLength * 0.5f + Chain.LinkRadius);
+		const FQuat Orientation = FQuat::FindBetweenNormals(FVector::UpVector, Link / LinkLength);
+
+		LinkHits.Reset();
+		World->SweepMultiByObjectType(LinkHits, (PreviousPositions[Index] + PreviousPositions[Index + 1]) * 0.5f,
+			(Positions[Index] + Positions[Index + 1]) * 0.5f, Orientation, LinkObjects, Capsule, Params);
+
+		for (const FHitResult& Hit : LinkHits)
+		{
+			FChainHit& ChainHit = Hits.AddDefaulted_GetRef();
+			ChainHit.Slot = Slot;
+			ChainHit.Owner = Owner;
+			ChainHit.LinkStart = Positions[Index];
+			ChainHit.LinkEnd = Positions[Index + 1];
+			ChainHit.Hit = Hit;
+		}
+	}
+}
+
+// ============================================================================
+// VISUALS
+// ============================================================================
+
+bool UYomiChainSubsystem::ShouldRenderVisuals() const
+{
+	return GetWorld() && GetWorld()->GetNetMode() != NM_DedicatedServer;
+}
+
+void UYomiChainSubsystem::UpdateVisuals(int32 Slot)
+{
+	const FChain& Chain = Chains[Slot];
+	UInstancedStaticMeshComponent* Instances = Chain.Instances.Get();
+	if (!Instances || !Instances->GetStaticMesh()) return;
+
+	const int32 Start = BlockStart(Slot);
+	const int32 Head = Start + Chain.NumParticles - 1;
+
+	// One instance per link, centred on it and facing along it
+	InstanceTransforms.Reset();
+	for (int32 Index = Start; Index < Head; ++Index)
+	{
+		const FVector Link = Positions[Index + 1] - Positions[Index];
+		const FQuat Rotation = Link.IsNearlyZero() ? FQuat::Identity : Link.ToOrientationQuat();
+		InstanceTransforms.Add(FTransform(Rotation, (Positions[Index] + Positions[Index + 1]) * 0.5f));
+	}
+
+	const int32 Existing = Instances->GetInstanceCount();
+	const int32 Needed = InstanceTransforms.Num();
+	if (Existing < Needed)
+	{
+		TArray<FTransform> Added(InstanceTransforms.GetData() + Existing, Needed - Existing);
+		Instances->AddInstances(Added, false, true, false);
+	}
+
+	Instances->BatchUpdateInstancesTransforms(0, InstanceTransforms, true, true, true);
+}
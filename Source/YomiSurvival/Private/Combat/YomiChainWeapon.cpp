@@ -0,0 +1,229 @@
+// Copyright (c) 2026 Yomi Survival. All Rights Reserved.
+
+#include "Combat/YomiChainWeapon.h"
+#include "Combat/YomiChainSubsystem.h"
+#include "Combat/YomiDamageSubsystem.h"
+#include "Combat/YomiStatusEffectSubsystem.h"
+#include "Character/YomiCharacterBase.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+AYomiChainWeapon::AYomiChainWeapon()
+{
+	// The chain subsystem steps the chain and calls back; there is no blade to sweep
+	PrimaryActorTick.bCanEverTick = false;
+
+	ChainLinks = CreateDefaultSubobject<UInstancedStaticMeshComponent>(TEXT("ChainLinks"));
+	ChainLinks->SetupAttachment(RootSceneComponent);
+	ChainLinks->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	ChainLinks->SetCanEverAffectNavigation(false);
+
+	WrapStatus.Effect = EYomiStatusEffect::Slow;
+	WrapStatus.Magnitude = 0.8f;
+	WrapStatus.Duration = 2.0f;
+}
+
+void AYomiChainWeapon::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	ReleaseChain();
+	Super::EndPlay(EndPlayReason);
+}
+
+// ============================================================================
+// COMBAT
+// ============================================================================
+
+void AYomiChainWeapon::StartLightAttack()
+{
+	ThrowChain(EChainMode::Strike);
+}
+
+void AYomiChainWeapon::StartHeavyAttack()
+{
+	ThrowChain(EChainMode::Wrap);
+}
+
+void AYomiChainWeapon::StartSpecialAttack()
+{
+	ThrowChain(EChainMode::Pull);
+}
+
+void AYomiChainWeapon::OnUnequipped()
+{
+	ReleaseChain();
+	Super::OnUnequipped();
+}
+
+void AYomiChainWeapon::ThrowChain(EChainMode Mode)
+{
+	if (IsBroken() || !WeaponOwner || IsChainOut()) return;
+
+	UYomiChainSubsystem* Chains = GetChainSubsystem();
+	if (!Chains) return;
+
+	// Pays out exactly as fast as the head flies, so the full length is reached at the weapon's range
+	const int32 Links = FMath::Clamp(NumLinks, 1, UYomiChainSubsystem::MaxParticles - 1);
+	ChainSlot = Chains->AcquireChain(this, Links, WeaponData.Range / Links, ThrowSpeed / Links, ChainLinks);
+	if (ChainSlot == INDEX_NONE) return;
+
+	HitActorsThisSwing.Reset();
+	bAreaSwing = false;
+	bHeavySwing = Mode == EChainMode::Wrap;
+	ChainMode = Mode;
+	bGrappling = false;
+
+	// The window is the attack's; the combat component closes it as usual
+	bDamageEnabled = true;
+
+	// Wraps and pulls only take hold with the head; strikes hit with the whole length
+	Chains->SetSweep(ChainSlot, ShouldSweepLocally(), Mode == EChainMode::Strike, LinkRadius, HeadRadius);
+	Chains->LaunchHead(ChainSlot, WeaponOwner->GetBaseAimRotation().Vector() * ThrowSpeed);
+
+	GetWorldTimerManager().SetTimer(ReelTimerHandle, this, &AYomiChainWeapon::BeginReel, ThrowDuration, false);
+}
+
+void AYomiChainWeapon::HandleChainHit(const FHitResult& Hit, const FVector& LinkStart, const FVector& LinkEnd, bool bHead)
+{
+	UYomiChainSubsystem* Chains = GetChainSubsystem();
+	if (!Chains || !IsChainOut()) return;
+
+	AActor* HitActor = Hit.GetActor();
+	if (AYomiCharacterBase* HitCharacter = Cast<AYomiCharacterBase>(HitActor))
+	{
+		if (!bDamageEnabled || !HitCharacter->IsAlive())
+		{
+			if (bHead) BeginReel();
+			return;
+		}
+
+		LastHitLinkStart = LinkStart;
+		LastHitLinkEnd = LinkEnd;
+		bLastHitHead = bHead;
+		ProcessSwingHit(HitActor, Hit);
+
+		if (!bHead) return;
+
+		if (ChainMode == EChainMode::Wrap)
+		{
+			// Stays wound around the foe for as long as the wrap lasts
+			Chains->AttachHead(ChainSlot, Hit.GetComponent(), Hit.BoneName, Hit.Location);
+			Chains->SetSweep(ChainSlot, false, false, LinkRadius, HeadRadius);
+			GetWorldTimerManager().SetTimer(ReelTimerHandle, this, &AYomiChainWeapon::BeginReel, WrapStatus.Duration, false);
+			return;
+		}
+
+		// Strikes bounce off; pulls were applied with the damage
+		BeginReel();
+		return;
+	}
+
+	if (!bHead) return;
+
+	if (ChainMode == EChainMode::Pull && Hit.GetComponent())
+	{
+		// Hooked into the world: haul the wielder along the chain. Runs wherever the owner's movement is simulated.
+		Chains->AttachHead(ChainSlot, Hit.GetComponent(), NAME_None, Hit.Location);
+		bGrappling = true;
+
+		if (HasAuthority() || WeaponOwner->IsLocallyControlled())
+		{
+			const FVector ToHead = (Hit.Location - WeaponOwner->GetActorLocation()).GetSafeNormal();
+			WeaponOwner->LaunchCharacter(ToHead * GrappleLaunchSpeed + FVector(0.0f, 0.0f, PullLift), true, true);
+		}
+	}
+
+	BeginReel();
+}
+
+void AYomiChainWeapon::HandleChainRetracted()
+{
+	ReleaseChain();
+}
+
+void AYomiChainWeapon::BeginReel()
+{
+	GetWorldTimerManager().ClearTimer(ReelTimerHandle);
+
+	UYomiChainSubsystem* Chains = GetChainSubsystem();
+	if (!Chains || !IsChainOut()) return;
+
+	// A grapple keeps its hook until the wielder arrives; anything else lets go
+	if (!bGrappling)
+	{
+		Chains->DetachHead(ChainSlot);
+	}
+
+	Chains->SetSweep(ChainSlot, false, false, LinkRadius, HeadRadius);
+	Chains->ReelIn(ChainSlot, ReelSpeed / FMath::Clamp(NumLinks, 1, UYomiChainSubsystem::MaxParticles - 1));
+}
+
+void AYomiChainWeapon::ReleaseChain()
+{
+	if (!IsChainOut()) return;
+
+	if (UYomiChainSubsystem* Chains = GetChainSubsystem())
+	{
+		Chains->ReleaseChain(ChainSlot);
+	}
+
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(ReelTimerHandle);
+	}
+
+	ChainSlot = INDEX_NONE;
+	bGrappling = false;
+}
+
+void AYomiChainWeapon::GetBladeSegment(FVector& OutBase, FVector& OutTip) const
+{
+	if (IsChainOut())
+	{
+		OutBase = LastHitLinkStart;
+		OutTip = LastHitLinkEnd;
+		return;
+	}
+
+	Super::GetBladeSegment(OutBase, OutTip);
+}
+
+void AYomiChainWeapon::ApplySwingHit(AActor* OtherActor, const FHitResult& HitResult)
+{
+	Super::ApplySwingHit(OtherActor, HitResult);
+
+	AYomiCharacterBase* HitCharacter = Cast<AYomiCharacterBase>(OtherActor);
+	if (!HitCharacter || !HitCharacter->IsAlive() || !WeaponOwner) return;
+
+	if (ChainMode == EChainMode::Wrap && WrapStatus.Effect != EYomiStatusEffect::None)
+	{
+		if (UYomiStatusEffectSubsystem* StatusEffects = GetWorld()->GetSubsystem<UYomiStatusEffectSubsystem>())
+		{
+			StatusEffects->ApplyInfliction(HitCharacter, WrapStatus, WeaponOwner);
+		}
+	}
+	else if (ChainMode == EChainMode::Pull)
+	{
+		if (UYomiDamageSubsystem* DamageSubsystem = GetWorld()->GetSubsystem<UYomiDamageSubsystem>())
+		{
+			const FVector ToOwner = (WeaponOwner->GetActorLocation() - HitCharacter->GetActorLocation()).GetSafeNormal2D();
+			DamageSubsystem->QueueKnockback(HitCharacter, ToOwner * PullSpeed + FVector(0.0f, 0.0f, PullLift));
+		}
+	}
+}
+
+FVector AYomiChainWeapon::GetChainAnchor() const
+{
+	if (WeaponMeshComponent->DoesSocketExist(ChainAnchorSocket))
+	{
+		return WeaponMeshComponent->GetSocketLocation(ChainAnchorSocket);
+	}
+	return GetActorLocation();
+}
+
+UYomiChainSubsystem* AYomiChainWeapon::GetChainSubsystem() const
+{
+	UWorld* World = GetWorld();
+	return World ? World->GetSubsystem<UYomiChainSubsystem>() : nullptr;
+}
@@ -2,56 +2,77 @@
 
 #include "Combat/YomiCombatComponent.h"
 #include "Combat/YomiWeaponBase.h"
+#include "Combat/YomiChainWeapon.h"
+#include "Combat/YomiCombatRules.h"
 #include "Character/YomiPlayerCharacter.h"
+#include "Character/YomiCharacterRegistry.h"
+#include "Combat/YomiLagCompensationSubsystem.h"
+#include "Core/YomiDataSubsystem.h"
+#include "Core/YomiActorPoolSubsystem.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/GameInstance.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Kismet/KismetSystemLibrary.h"
+#include "Net/UnrealNetwork.h"
+#include "TimerManager.h"
 
 UYomiCombatComponent::UYomiCombatComponent()
 {
+	// Attack and parry windows run on timers; tick only while locked on
 	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+
+	// Needed for the owning client to report melee hits and send predicted actions
+	SetIsReplicatedByDefault(true);
+
+	DefaultWeaponClass = AYomiWeaponBase::StaticClass();
+	WeaponActorClasses.Add(EWeaponClass::Chain, AYomiChainWeapon::StaticClass());
+	WeaponActorClasses.Add(EWeaponClass::RopeDart, AYomiChainWeapon::StaticClass());
 }
 
 void UYomiCombatComponent::BeginPlay()
 {
 	Super::BeginPlay();
 	OwnerPlayer = Cast<AYomiPlayerCharacter>(GetOwner());
+
+	// Pooled enemies are parked rather than destroyed, so lock-on has to hear about it
+	if (UYomiActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UYomiActorPoolSubsystem>())
+	{
+		Pool->OnActorReleased.AddUObject(this, &UYomiCombatComponent::HandlePooledActorReleased);
+	}
 }
 
-void UYomiCombatComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UYomiCombatComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-	// Attack cooldown
-	if (AttackCooldownTimer > 0.0f)
+	if (UWorld* World = GetWorld())
 	{
-		AttackCooldownTimer -= DeltaTime;
-		if (AttackCooldownTimer <= 0.0f)
+		World->GetTimerManager().ClearTimer(AttackTimerHandle);
+		World->GetTimerManager().ClearTimer(ParryTimerHandle);
+		World->GetTimerManager().ClearTimer(SendFrameTimerHandle);
+
+		if (UYomiActorPoolSubsystem* Pool = World->GetSubsystem<UYomiActorPoolSubsystem>())
 		{
-			EndAttack();
+			Pool->OnActorReleased.RemoveAll(this);
 		}
 	}
 
-	// Parry window timer
-	if (bInParryWindow)
+	Super::EndPlay(EndPlayReason);
+}
+
+void UYomiCombatComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (!IsValidLockOnTarget(LockedTarget))
 	{
-		ParryTimer -= DeltaTime;
-		if (ParryTimer <= 0.0f)
-		{
-			bInParryWindow = false;
-		}
+		SetLockedTarget(nullptr);
+		return;
 	}
 
-	// Lock-on rotation
-	if (LockedTarget)
+	// The server only keeps the lock for aim assist; the camera belongs to whoever is playing
+	if (OwnerPlayer && OwnerPlayer->IsLocallyControlled())
 	{
-		if (!LockedTarget->IsValidLowLevel() || LockedTarget->IsActorBeingDestroyed())
-		{
-			LockedTarget = nullptr;
-		}
-		else
-		{
-			UpdateLockOnRotation(DeltaTime);
-		}
+		UpdateLockOnRotation(DeltaTime);
 	}
 }
 
@@ -61,7 +82,7 @@ void UYomiCombatComponent::TickComponent(float DeltaTime, ELevelTick TickType, F
 
 bool UYomiCombatComponent::EquipWeapon(AYomiWeaponBase* Weapon)
 {
-	if (!Weapon || !OwnerPlayer) return false;
+	if (!Weapon || !OwnerPlayer || !OwnerPlayer->HasAuthority()) return false;
 
 	if (EquippedWeapon)
 	{
@@ -69,79 +90,181 @@ bool UYomiCombatComponent::EquipWeapon(AYomiWeaponBase* Weapon)
 	}
 
 	EquippedWeapon = Weapon;
+	bSpawnedEquippedWeapon = false;
 	EquippedWeapon->OnEquipped(OwnerPlayer);
 
 	UE_LOG(LogYomiCombat, Log, TEXT("Equipped: %s"), *Weapon->GetWeaponData().DisplayName.ToString());
 	return true;
 }
 
+AYomiWeaponBase* UYomiCombatComponent::EquipWeaponOfType(EWeaponType WeaponType)
+{
+	UWorld* World = GetWorld();
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	UYomiDataSubsystem* DataSubsystem = GameInstance ? GameInstance->GetSubsystem<UYomiDataSubsystem>() : nullptr;
+	if (!DataSubsystem || !OwnerPlayer || !OwnerPlayer->HasAuthority()) return nullptr;
+
+	const FWeaponData Data = DataSubsystem->GetWeaponData(WeaponType);
+	if (Data.WeaponClass == EWeaponClass::None) return nullptr;
+
+	const TSubclassOf<AYomiWeaponBase>* MappedClass = WeaponActorClasses.Find(Data.WeaponClass);
+	const TSubclassOf<AYomiWeaponBase> ActorClass = MappedClass && *MappedClass ? *MappedClass : DefaultWeaponClass;
+	if (!ActorClass) return nullptr;
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.Owner = OwnerPlayer;
+	SpawnParams.Instigator = OwnerPlayer;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AYomiWeaponBase* Weapon = World->SpawnActor<AYomiWeaponBase>(ActorClass, OwnerPlayer->GetActorTransform(), SpawnParams);
+	if (!Weapon) return nullptr;
+
+	Weapon->InitializeWeapon(Data);
+	if (!EquipWeapon(Weapon))
+	{
+		Weapon->Destroy();
+		return nullptr;
+	}
+
+	bSpawnedEquippedWeapon = true;
+	return Weapon;
+}
+
 void UYomiCombatComponent::UnequipWeapon()
 {
-	if (EquippedWeapon)
+	if (EquippedWeapon && GetOwner()->HasAuthority())
 	{
 		EquippedWeapon->OnUnequipped();
+		if (bSpawnedEquippedWeapon)
+		{
+			EquippedWeapon->Destroy();
+		}
 		EquippedWeapon = nullptr;
+		bSpawnedEquippedWeapon = false;
+	}
+}
+
+void UYomiCombatComponent::OnRep_EquippedWeapon(AYomiWeaponBase* PreviousWeapon)
+{
+	// Can arrive with the initial bunch, before BeginPlay
+	if (!OwnerPlayer)
+	{
+		OwnerPlayer = Cast<AYomiPlayerCharacter>(GetOwner());
+	}
+
+	if (IsValid(PreviousWeapon) && PreviousWeapon != EquippedWeapon)
+	{
+		PreviousWeapon->OnUnequipped();
+	}
+
+	if (EquippedWeapon && OwnerPlayer)
+	{
+		EquippedWeapon->OnEquipped(OwnerPlayer);
 	}
 }
 
+void UYomiCombatComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	// Everyone sees the weapon in the owner's hand
+	DOREPLIFETIME(UYomiCombatComponent, EquippedWeapon);
+}
+
 // ============================================================================
 // ATTACKS
 // ============================================================================
 
 void UYomiCombatComponent::ExecuteLightAttack()
 {
-	if (bIsAttacking || bIsBlocking || !EquippedWeapon || EquippedWeapon->IsBroken()) return;
-	if (!OwnerPlayer) return;
+	PerformAction(EYomiPredictedAction::LightAttack);
+}
 
-	float StaminaCost = EquippedWeapon->GetWeaponData().StaminaCost;
-	if (!OwnerPlayer->ConsumeStamina(StaminaCost)) return;
+void UYomiCombatComponent::ExecuteHeavyAttack()
+{
+	PerformAction(EYomiPredictedAction::HeavyAttack);
+}
 
-	bIsAttacking = true;
-	AttackCooldownTimer = 1.0f / EquippedWeapon->GetWeaponData().AttackSpeed;
+void UYomiCombatComponent::ExecuteSpecialAttack()
+{
+	PerformAction(EYomiPredictedAction::SpecialAttack);
+}
 
-	EquippedWeapon->StartLightAttack();
-	OnAttackStarted.Broadcast();
+bool UYomiCombatComponent::IsAttackAction(EYomiPredictedAction Action)
+{
+	return Action == EYomiPredictedAction::LightAttack || Action == EYomiPredictedAction::HeavyAttack
+		|| Action == EYomiPredictedAction::SpecialAttack || Action == EYomiPredictedAction::KiPowerStrike;
+}
+
+bool UYomiCombatComponent::CanStartAttack(EYomiPredictedAction Action, bool bIgnoreCurrentAttack) const
+{
+	if (!OwnerPlayer || !EquippedWeapon || (bIsAttacking && !bIgnoreCurrentAttack)) return false;
 
-	UE_LOG(LogYomiCombat, Verbose, TEXT("Light attack executed"));
+	const FWeaponData& Data = EquippedWeapon->GetWeaponData();
+	switch (Action)
+	{
+	case EYomiPredictedAction::LightAttack:
+	case EYomiPredictedAction::HeavyAttack:
+		return !bIsBlocking && EquippedWeapon->CanStartAttack()
+			&& OwnerPlayer->GetCurrentStamina() >= YomiCombatRules::AttackStaminaCost(Data, Action == EYomiPredictedAction::HeavyAttack);
+	case EYomiPredictedAction::SpecialAttack:
+		return EquippedWeapon->CanStartAttack() && (Data.KiCost <= 0.0f || OwnerPlayer->GetCurrentKi() >= Data.KiCost);
+	case EYomiPredictedAction::KiPowerStrike:
+		return EquippedWeapon->CanStartAttack() && OwnerPlayer->GetCurrentKi() >= KiPowerStrikeCost;
+	default:
+		return false;
+	}
 }
 
-void UYomiCombatComponent::ExecuteHeavyAttack()
+bool UYomiCombatComponent::StartAttack(bool bHeavy)
 {
-	if (bIsAttacking || bIsBlocking || !EquippedWeapon || EquippedWeapon->IsBroken()) return;
-	if (!OwnerPlayer) return;
+	if (!CanStartAttack(bHeavy ? EYomiPredictedAction::HeavyAttack : EYomiPredictedAction::LightAttack, false)) return false;
 
-	float StaminaCost = EquippedWeapon->GetWeaponData().StaminaCost * 1.5f;
-	if (!OwnerPlayer->ConsumeStamina(StaminaCost)) return;
+	const FWeaponData& Data = EquippedWeapon->GetWeaponData();
+	if (!OwnerPlayer->ConsumeStamina(YomiCombatRules::AttackStaminaCost(Data, bHeavy))) return false;
 
-	bIsAttacking = true;
-	AttackCooldownTimer = (1.0f / EquippedWeapon->GetWeaponData().AttackSpeed) * 1.5f;
+	BeginAttack(YomiCombatRules::AttackDuration(Data, bHeavy));
 
-	EquippedWeapon->StartHeavyAttack();
+	if (bHeavy)
+	{
+		EquippedWeapon->StartHeavyAttack();
+	}
+	else
+	{
+		EquippedWeapon->StartLightAttack();
+	}
 	OnAttackStarted.Broadcast();
 
-	UE_LOG(LogYomiCombat, Verbose, TEXT("Heavy attack executed"));
+	UE_LOG(LogYomiCombat, Verbose, TEXT("%s attack executed"), bHeavy ? TEXT("Heavy") : TEXT("Light"));
+	return true;
 }
 
-void UYomiCombatComponent::ExecuteSpecialAttack()
+bool UYomiCombatComponent::StartSpecialAttack()
 {
-	if (bIsAttacking || !EquippedWeapon || EquippedWeapon->IsBroken()) return;
-	if (!OwnerPlayer) return;
+	if (!CanStartAttack(EYomiPredictedAction::SpecialAttack, false)) return false;
 
 	float KiCost = EquippedWeapon->GetWeaponData().KiCost;
-	if (KiCost > 0.0f && !OwnerPlayer->ConsumeKi(KiCost)) return;
+	if (KiCost > 0.0f && !OwnerPlayer->ConsumeKi(KiCost)) return false;
 
-	bIsAttacking = true;
-	AttackCooldownTimer = (1.0f / EquippedWeapon->GetWeaponData().AttackSpeed) * 2.0f;
+	BeginAttack(YomiCombatRules::AttackDuration(EquippedWeapon->GetWeaponData(), false) * YomiCombatRules::SpecialAttackDurationScale);
 
 	EquippedWeapon->StartSpecialAttack();
 	OnAttackStarted.Broadcast();
 
 	UE_LOG(LogYomiCombat, Log, TEXT("Special attack executed (Ki cost: %f)"), KiCost);
+	return true;
+}
+
+void UYomiCombatComponent::BeginAttack(float Duration)
+{
+	bIsAttacking = true;
+	GetWorld()->GetTimerManager().SetTimer(AttackTimerHandle, this, &UYomiCombatComponent::EndAttack, FMath::Max(Duration, KINDA_SMALL_NUMBER), false);
 }
 
 void UYomiCombatComponent::EndAttack()
 {
 	bIsAttacking = false;
+	ActiveAttackKey = INDEX_NONE;
 	if (EquippedWeapon)
 	{
 		EquippedWeapon->DisableDamageCollision();
@@ -149,6 +272,309 @@ void UYomiCombatComponent::EndAttack()
 	OnAttackEnded.Broadcast();
 }
 
+void UYomiCombatComponent::CancelAttack()
+{
+	if (!bIsAttacking) return;
+
+	GetWorld()->GetTimerManager().ClearTimer(AttackTimerHandle);
+	EndAttack();
+}
+
+void UYomiCombatComponent::ReportMeleeHit(AYomiCharacterBase* Target, const FVector& BladeBase, const FVector& BladeTip, uint8 HitPart, float ClientTime)
+{
+	// The frame is otherwise sent from a timer that runs after this frame's sweeps; both RPCs are reliable, so order holds
+	if (!OutgoingFrame.IsEmpty())
+	{
+		GetWorld()->GetTimerManager().ClearTimer(SendFrameTimerHandle);
+		SendActionFrame();
+	}
+
+	ServerReportMeleeHit(Target, BladeBase, BladeTip, HitPart, ClientTime);
+}
+
+void UYomiCombatComponent::ServerReportMeleeHit_Implementation(AYomiCharacterBase* Target, FVector_NetQuantize BladeBase,
+	FVector_NetQuantize BladeTip, uint8 HitPart, float ClientTime)
+{
+	if (!IsValid(Target) || !EquippedWeapon || !OwnerPlayer || !Target->IsAlive()) return;
+
+	const FVector BladeCenter = (BladeBase + BladeTip) * 0.5f;
+	if (FVector::DistSquared(BladeCenter, OwnerPlayer->GetActorLocation()) > FMath::Square(MaxReportedHitDistance))
+	{
+		UE_LOG(LogYomiCombat, Warning, TEXT("%s reported a hit with a blade out of reach"), *OwnerPlayer->GetName());
+		return;
+	}
+
+	UYomiLagCompensationSubsystem* LagCompensation = GetWorld()->GetSubsystem<UYomiLagCompensationSubsystem>();
+	if (LagCompensation && !LagCompensation->ValidateHit(Target, BladeBase, BladeTip, EquippedWeapon->GetHitValidationRadius(HitPart), ClientTime))
+	{
+		return;
+	}
+
+	FHitResult Hit;
+	Hit.Location = BladeCenter;
+	Hit.ImpactPoint = BladeCenter;
+	Hit.TraceStart = BladeBase;
+	Hit.TraceEnd = BladeTip;
+	Hit.HitObjectHandle = FActorInstanceHandle(Target);
+	Hit.Component = Target->GetCapsuleComponent();
+
+	EquippedWeapon->ProcessReportedHit(Target, Hit);
+}
+
+// ============================================================================
+// PREDICTED ACTIONS
+// ============================================================================
+
+void FYomiActionFrame::Add(EYomiPredictedAction Action, const FVector& Direction)
+{
+	check(!IsFull());
+
+	const int32 Index = NumActions++;
+	Actions[Index] = Action;
+	if (!Direction.IsNearlyZero())
+	{
+		DirectionMask |= 1 << Index;
+		Yaws[Index] = FRotator::CompressAxisToByte(Direction.Rotation().Yaw);
+	}
+}
+
+FVector FYomiActionFrame::GetDirection(int32 Index) const
+{
+	if (!(DirectionMask & (1 << Index))) return FVector::ZeroVector;
+	return FRotator(0.0f, FRotator::DecompressAxisFromByte(Yaws[Index]), 0.0f).Vector();
+}
+
+FVector FYomiActionFrame::QuantizeDirection(const FVector& Direction)
+{
+	if (Direction.IsNearlyZero()) return FVector::ZeroVector;
+	return FRotator(0.0f, FRotator::DecompressAxisFromByte(FRotator::CompressAxisToByte(Direction.Rotation().Yaw)), 0.0f).Vector();
+}
+
+bool FYomiActionFrame::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	// 10-bit key, 2-bit count, then per action a 3-bit type, a direction flag and an optional byte of yaw
+	uint32 Key = FirstKey;
+	uint32 Count = FMath::Max(NumActions, (uint8)1) - 1;
+	Ar.SerializeInt(Key, KeyRange);
+	Ar.SerializeInt(Count, MaxActions);
+
+	if (Ar.IsLoading())
+	{
+		FirstKey = static_cast<uint16>(Key);
+		NumActions = static_cast<uint8>(Count + 1);
+		DirectionMask = 0;
+	}
+
+	bOutSuccess = true;
+	for (int32 i = 0; i < NumActions; ++i)
+	{
+		uint32 Action = static_cast<uint32>(Actions[i]);
+		Ar.SerializeInt(Action, static_cast<uint32>(EYomiPredictedAction::MAX));
+
+		uint8 bHasDirection = (DirectionMask >> i) & 1;
+		Ar.SerializeBits(&bHasDirection, 1);
+		if (bHasDirection)
+		{
+			Ar << Yaws[i];
+		}
+
+		if (Ar.IsLoading())
+		{
+			Actions[i] = static_cast<EYomiPredictedAction>(Action);
+			DirectionMask |= (bHasDirection & 1) << i;
+			bOutSuccess &= Action != static_cast<uint32>(EYomiPredictedAction::None);
+		}
+	}
+
+	return true;
+}
+
+bool FYomiActionAck::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	uint32 Key = FirstKey;
+	uint32 Count = FMath::Max(NumActions, (uint8)1) - 1;
+	Ar.SerializeInt(Key, FYomiActionFrame::KeyRange);
+	Ar.SerializeInt(Count, FYomiActionFrame::MaxActions);
+
+	if (Ar.IsLoading())
+	{
+		FirstKey = static_cast<uint16>(Key);
+		NumActions = static_cast<uint8>(Count + 1);
+		RejectedMask = 0;
+	}
+	Ar.SerializeBits(&RejectedMask, NumActions);
+
+	bOutSuccess = true;
+	return true;
+}
+
+bool UYomiCombatComponent::PerformAction(EYomiPredictedAction Action, const FVector& Direction)
+{
+	if (!OwnerPlayer || Action == EYomiPredictedAction::None) return false;
+
+	const FVector SentDirection = FYomiActionFrame::QuantizeDirection(Direction);
+
+	// Server and standalone players act directly; there is nothing to confirm
+	if (OwnerPlayer->HasAuthority())
+	{
+		return ExecuteAction(Action, SentDirection, 0.0f);
+	}
+
+	if (!OwnerPlayer->IsLocallyControlled() || PendingActions.Num() >= MaxPendingActions) return false;
+
+	const float StaminaBefore = OwnerPlayer->GetCurrentStamina();
+	const float KiBefore = OwnerPlayer->GetCurrentKi();
+
+	if (!ExecuteAction(Action, SentDirection, 0.0f)) return false;
+
+	if (OutgoingFrame.IsEmpty())
+	{
+		OutgoingFrame.FirstKey = NextPredictionKey;
+		SendFrameTimerHandle = GetWorld()->GetTimerManager().SetTimerForNextTick(this, &UYomiCombatComponent::SendActionFrame);
+	}
+	OutgoingFrame.Add(Action, SentDirection);
+
+	if (IsAttackAction(Action))
+	{
+		ActiveAttackKey = NextPredictionKey;
+	}
+
+	FPendingAction& Pending = PendingActions.AddDefaulted_GetRef();
+	Pending.Key = NextPredictionKey;
+	Pending.Action = Action;
+	Pending.StaminaSpent = FMath::Max(0.0f, StaminaBefore - OwnerPlayer->GetCurrentStamina());
+	Pending.KiSpent = FMath::Max(0.0f, KiBefore - OwnerPlayer->GetCurrentKi());
+
+	NextPredictionKey = (NextPredictionKey + 1) % FYomiActionFrame::KeyRange;
+
+	if (OutgoingFrame.IsFull())
+	{
+		GetWorld()->GetTimerManager().ClearTimer(SendFrameTimerHandle);
+		SendActionFrame();
+	}
+	return true;
+}
+
+bool UYomiCombatComponent::ExecuteAction(EYomiPredictedAction Action, const FVector& Direction, float Tolerance)
+{
+	if (!OwnerPlayer) return false;
+
+	if (IsAttackAction(Action) && bIsAttacking && Tolerance > 0.0f
+		&& GetWorld()->GetTimerManager().GetTimerRemaining(AttackTimerHandle) <= Tolerance)
+	{
+		// Only cut the current attack short for one that is going to start
+		if (!CanStartAttack(Action, true)) return false;
+		CancelAttack();
+	}
+
+	switch (Action)
+	{
+	case EYomiPredictedAction::LightAttack:		return StartAttack(false);
+	case EYomiPredictedAction::HeavyAttack:		return StartAttack(true);
+	case EYomiPredictedAction::SpecialAttack:	return StartSpecialAttack();
+	case EYomiPredictedAction::DodgeRoll:		return OwnerPlayer->PerformDodgeRoll(Direction, Tolerance);
+	case EYomiPredictedAction::KiDash:			return StartKiDash(Direction);
+	case EYomiPredictedAction::KiPowerStrike:	return StartKiPowerStrike();
+	case EYomiPredictedAction::KiSpiritArrow:	return StartKiSpiritArrow();
+	default:									return false;
+	}
+}
+
+void UYomiCombatComponent::SendActionFrame()
+{
+	if (OutgoingFrame.IsEmpty()) return;
+
+	ServerExecuteActions(OutgoingFrame);
+	OutgoingFrame = FYomiActionFrame();
+}
+
+void UYomiCombatComponent::ServerExecuteActions_Implementation(const FYomiActionFrame& Frame)
+{
+	FYomiActionAck Ack;
+	Ack.FirstKey = Frame.FirstKey;
+	Ack.NumActions = Frame.NumActions;
+
+	for (int32 i = 0; i < Frame.NumActions; ++i)
+	{
+		if (!ExecuteAction(Frame.Actions[i], Frame.GetDirection(i), ServerActionTolerance))
+		{
+			Ack.RejectedMask |= 1 << i;
+		}
+	}
+
+	if (Ack.RejectedMask != 0)
+	{
+		UE_LOG(LogYomiCombat, Verbose, TEXT("Rejected predicted actions from %s (mask %x)"),
+			OwnerPlayer ? *OwnerPlayer->GetName() : TEXT("unknown"), Ack.RejectedMask);
+	}
+
+	ClientAcknowledgeActions(Ack);
+}
+
+void UYomiCombatComponent::ClientAcknowledgeActions_Implementation(const FYomiActionAck& Ack)
+{
+	for (int32 i = 0; i < Ack.NumActions; ++i)
+	{
+		const uint16 Key = (Ack.FirstKey + i) % FYomiActionFrame::KeyRange;
+		const int32 Index = PendingActions.IndexOfByPredicate([Key](const FPendingAction& Pending) { return Pending.Key == Key; });
+		if (Index == INDEX_NONE) continue;
+
+		const FPendingAction Pending = PendingActions[Index];
+		PendingActions.RemoveAt(Index, 1, EAllowShrinking::No);
+
+		if (Ack.RejectedMask & (1 << i))
+		{
+			RollBackAction(Pending);
+		}
+	}
+}
+
+void UYomiCombatComponent::RollBackAction(const FPendingAction& Pending)
+{
+	if (!OwnerPlayer) return;
+
+	OwnerPlayer->RestoreStamina(Pending.StaminaSpent);
+	OwnerPlayer->RestoreKi(Pending.KiSpent);
+
+	// Movement is corrected by the character movement component; only an attack needs undoing here,
+	// and only while it is still this one rather than a later attack the server accepted
+	if (IsAttackAction(Pending.Action) && ActiveAttackKey == Pending.Key)
+	{
+		CancelAttack();
+	}
+
+	UE_LOG(LogYomiCombat, Log, TEXT("Mispredicted %s rolled back (%.1f stamina, %.1f Ki refunded)"),
+		*UEnum::GetValueAsString(Pending.Action), Pending.StaminaSpent, Pending.KiSpent);
+}
+
+float UYomiCombatComponent::GetUnconfirmedStaminaSpend() const
+{
+	float Total = 0.0f;
+	for (const FPendingAction& Pending : PendingActions)
+	{
+		Total += Pending.StaminaSpent;
+	}
+	return Total;
+}
+
+float UYomiCombatComponent::GetUnconfirmedKiSpend() const
+{
+	float Total = 0.0f;
+	for (const FPendingAction& Pending : PendingActions)
+	{
+		Total += Pending.KiSpent;
+	}
+	return Total;
+}
+
+FVector UYomiCombatComponent::GetActionDirection() const
+{
+	if (!OwnerPlayer) return FVector::ZeroVector;
+
+	const FVector Direction = OwnerPlayer->GetLastMovementInputVector().GetSafeNormal2D();
+	return Direction.IsNearlyZero() ? OwnerPlayer->GetActorForwardVector() : Direction;
+}
+
 // ============================================================================
 // BLOCKING & PARRYING
 // ============================================================================
@@ -160,7 +586,7 @@ void UYomiCombatComponent::StartBlocking()
 
 	bIsBlocking = true;
 	bInParryWindow = true;
-	ParryTimer = ParryWindowDuration;
+	GetWorld()->GetTimerManager().SetTimer(ParryTimerHandle, this, &UYomiCombatComponent::CloseParryWindow, ParryWindowDuration, false);
 
 	EquippedWeapon->StartBlock();
 }
@@ -168,7 +594,7 @@ void UYomiCombatComponent::StartBlocking()
 void UYomiCombatComponent::StopBlocking()
 {
 	bIsBlocking = false;
-	bInParryWindow = false;
+	CloseParryWindow();
 
 	if (EquippedWeapon)
 	{
@@ -176,6 +602,12 @@ void UYomiCombatComponent::StopBlocking()
 	}
 }
 
+void UYomiCombatComponent::CloseParryWindow()
+{
+	bInParryWindow = false;
+	GetWorld()->GetTimerManager().ClearTimer(ParryTimerHandle);
+}
+
 float UYomiCombatComponent::ProcessBlockedDamage(float IncomingDamage, EDamageType DamageType)
 {
 	if (!bIsBlocking || !EquippedWeapon) return IncomingDamage;
@@ -190,7 +622,7 @@ float UYomiCombatComponent::ProcessBlockedDamage(float IncomingDamage, EDamageTy
 		{
 			OwnerPlayer->AddHonor(2.0f);
 		}
-		return 0.0f;
+		return YomiCombatRules::BlockedDamage(IncomingDamage, EquippedWeapon->GetWeaponData(), true);
 	}
 
 	// Regular block
@@ -199,8 +631,7 @@ float UYomiCombatComponent::ProcessBlockedDamage(float IncomingDamage, EDamageTy
 		OwnerPlayer->ConsumeStamina(BlockStaminaCostPerHit);
 	}
 
-	float BlockReduction = EquippedWeapon->GetWeaponData().BlockDamageReduction;
-	return IncomingDamage * (1.0f - BlockReduction);
+	return YomiCombatRules::BlockedDamage(IncomingDamage, EquippedWeapon->GetWeaponData(), false);
 }
 
 // ============================================================================
@@ -209,52 +640,66 @@ float UYomiCombatComponent::ProcessBlockedDamage(float IncomingDamage, EDamageTy
 
 void UYomiCombatComponent::ToggleLockOn()
 {
-	if (LockedTarget)
+	SetLockedTarget(LockedTarget ? nullptr : FindLockOnTarget());
+}
+
+void UYomiCombatComponent::SetLockedTarget(AActor* NewTarget)
+{
+	const bool bChanged = LockedTarget != NewTarget;
+	LockedTarget = NewTarget;
+	SetComponentTickEnabled(LockedTarget != nullptr);
+
+	// Reliable and ordered with the action frames, so a shot fired after locking on is assisted on the server too
+	if (bChanged && OwnerPlayer && !OwnerPlayer->HasAuthority() && OwnerPlayer->IsLocallyControlled())
 	{
-		LockedTarget = nullptr;
-		return;
+		ServerSetLockedTarget(NewTarget);
 	}
-
-	LockedTarget = FindLockOnTarget();
 }
 
-AActor* UYomiCombatComponent::FindLockOnTarget() const
+void UYomiCombatComponent::ServerSetLockedTarget_Implementation(AActor* NewTarget)
 {
-	if (!OwnerPlayer) return nullptr;
+	if (NewTarget)
+	{
+		const bool bInRange = OwnerPlayer && FVector::DistSquared(NewTarget->GetActorLocation(), OwnerPlayer->GetActorLocation())
+			<= FMath::Square(LockOnRange + LockOnRangeTolerance);
+		if (!bInRange || !IsValidLockOnTarget(NewTarget))
+		{
+			NewTarget = nullptr;
+		}
+	}
 
-	FVector Start = OwnerPlayer->GetActorLocation();
-	TArray<FHitResult> HitResults;
+	SetLockedTarget(NewTarget);
+}
 
-	FCollisionShape Sphere = FCollisionShape::MakeSphere(LockOnRange);
-	FCollisionQueryParams Params;
-	Params.AddIgnoredActor(OwnerPlayer);
+bool UYomiCombatComponent::IsValidLockOnTarget(const AActor* Target) const
+{
+	if (!IsValid(Target) || Target->IsActorBeingDestroyed() || Target->IsHidden()) return false;
 
-	if (GetWorld()->SweepMultiByChannel(HitResults, Start, Start, FQuat::Identity, ECC_Pawn, Sphere, Params))
+	// Corpses stay in the world until the pool takes them back
+	const AYomiCharacterBase* Character = Cast<AYomiCharacterBase>(Target);
+	return !Character || Character->IsAlive();
+}
+
+void UYomiCombatComponent::HandlePooledActorReleased(AActor* Actor)
+{
+	if (Actor && Actor == LockedTarget)
 	{
-		AActor* ClosestTarget = nullptr;
-		float ClosestDist = LockOnRange;
+		SetLockedTarget(nullptr);
+	}
+}
 
-		for (const FHitResult& Hit : HitResults)
-		{
-			AActor* HitActor = Hit.GetActor();
-			if (!HitActor || HitActor == OwnerPlayer) continue;
-
-			// Check if it's an enemy
-			AYomiCharacterBase* Character = Cast<AYomiCharacterBase>(HitActor);
-			if (!Character || !Character->IsAlive()) continue;
-
-			float Dist = FVector::Dist(Start, HitActor->GetActorLocation());
-			if (Dist < ClosestDist)
-			{
-				ClosestDist = Dist;
-				ClosestTarget = HitActor;
-			}
-		}
+AActor* UYomiCombatComponent::FindLockOnTarget() const
+{
+	if (!OwnerPlayer) return nullptr;
 
-		return ClosestTarget;
-	}
+	const UYomiCharacterRegistry* Registry = GetWorld()->GetSubsystem<UYomiCharacterRegistry>();
+	if (!Registry) return nullptr;
 
-	return nullptr;
+	FYomiCharacterFilter Filter;
+	Filter.ExcludeAlliesOf = OwnerPlayer->GetTeam();
+	Filter.IgnoreActor = OwnerPlayer;
+
+	return Registry->FindNearestCharacter(OwnerPlayer->GetActorLocation(), LockOnRange, Filter);
 }
 
 void UYomiCombatComponent::UpdateLockOnRotation(float DeltaTime)
@@ -276,41 +721,54 @@ void UYomiCombatComponent::UpdateLockOnRotation(float DeltaTime)
 
 void UYomiCombatComponent::KiDash()
 {
-	if (!OwnerPlayer || !OwnerPlayer->ConsumeKi(KiDashCost)) return;
+	PerformAction(EYomiPredictedAction::KiDash, GetActionDirection());
+}
 
-	FVector DashDirection = OwnerPlayer->GetLastMovementInputVector();
-	if (DashDirection.IsNearlyZero())
-	{
-		DashDirection = OwnerPlayer->GetActorForwardVector();
-	}
+void UYomiCombatComponent::KiPowerStrike()
+{
+	PerformAction(EYomiPredictedAction::KiPowerStrike);
+}
+
+void UYomiCombatComponent::KiSpiritArrow()
+{
+	PerformAction(EYomiPredictedAction::KiSpiritArrow);
+}
+
+bool UYomiCombatComponent::StartKiDash(const FVector& Direction)
+{
+	if (!OwnerPlayer || !OwnerPlayer->ConsumeKi(KiDashCost)) return false;
+
+	const FVector DashDirection = Direction.IsNearlyZero() ? OwnerPlayer->GetActorForwardVector() : Direction;
 
 	OwnerPlayer->LaunchCharacter(DashDirection * 1500.0f, true, false);
 	UE_LOG(LogYomiCombat, Log, TEXT("Ki Dash!"));
+	return true;
 }
 
-void UYomiCombatComponent::KiPowerStrike()
+bool UYomiCombatComponent::StartKiPowerStrike()
 {
-	if (!OwnerPlayer || !EquippedWeapon) return;
-	if (!OwnerPlayer->ConsumeKi(KiPowerStrikeCost)) return;
+	if (!CanStartAttack(EYomiPredictedAction::KiPowerStrike, false)) return false;
+	if (!OwnerPlayer->ConsumeKi(KiPowerStrikeCost)) return false;
 
 	// Enhanced damage attack with spirit energy
-	bIsAttacking = true;
-	AttackCooldownTimer = 1.0f;
+	BeginAttack(1.0f);
 
 	EquippedWeapon->StartSpecialAttack();
 	OnAttackStarted.Broadcast();
 
 	UE_LOG(LogYomiCombat, Log, TEXT("Ki Power Strike!"));
+	return true;
 }
 
-void UYomiCombatComponent::KiSpiritArrow()
+bool UYomiCombatComponent::StartKiSpiritArrow()
 {
-	if (!OwnerPlayer) return;
-	if (!OwnerPlayer->ConsumeKi(KiSpiritArrowCost)) return;
+	if (!OwnerPlayer) return false;
+	if (!OwnerPlayer->ConsumeKi(KiSpiritArrowCost)) return false;
 
 	// In full implementation, this would spawn a spirit projectile
 	FVector SpawnLocation = OwnerPlayer->GetActorLocation() + OwnerPlayer->GetActorForwardVector() * 100.0f;
 	FRotator SpawnRotation = OwnerPlayer->GetControlRotation();
 
 	UE_LOG(LogYomiCombat, Log, TEXT("Ki Spirit Arrow fired from %s"), *SpawnLocation.ToString());
+	return true;
 }
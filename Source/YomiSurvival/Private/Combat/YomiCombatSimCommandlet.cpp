@@ -0,0 +1,447 @@
+// Copyright (c) 2026 Yomi Survival. All Rights Reserved.
+
+#include "Combat/YomiCombatSimCommandlet.h"
+#include "Combat/YomiCombatRules.h"
+#include "Core/YomiDataSubsystem.h"
+#include "AI/YomiEnemyBase.h"
+#include "Character/YomiPlayerCharacter.h"
+#include "Async/ParallelFor.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectIterator.h"
+
+namespace YomiCombatSim
+{
+	constexpr int32 NumDamageTypes = static_cast<int32>(EDamageType::MAX);
+
+	struct FSettings
+	{
+		int32 DuelsPerMatchup = 1000;
+		int32 Seed = 1337;
+		float TimeStep = 1.0f / 60.0f;
+		float MaxDuelTime = 180.0f;
+
+		/** Chance the player raises their guard against an incoming attack when free to. */
+		float DefendChance = 0.5f;
+
+		/** Chance a raised guard lands inside the parry window. */
+		float ParryChance = 0.25f;
+	};
+
+	struct FPlayerProfile
+	{
+		float MaxHealth = 100.0f;
+		float MaxStamina = 100.0f;
+		float StaminaRegenRate = 15.0f;
+		float StaminaRegenDelay = 1.0f;
+
+		/** The wielder's Damage attribute; 1 without food or blessings. */
+		float DamageScale = 1.0f;
+	};
+
+	struct FEnemyProfile
+	{
+		FString Name;
+		float MaxHealth = 50.0f;
+		float AttackDamage = 15.0f;
+		EDamageType DamageType = EDamageType::Physical;
+		float AttackCooldown = 2.0f;
+	};
+
+	struct FArmorProfile
+	{
+		FString Name;
+		float Resistances[NumDamageTypes] = {};
+	};
+
+	struct FMatchup
+	{
+		int32 Weapon = 0;
+		int32 Armor = 0;
+		int32 Enemy = 0;
+	};
+
+	struct FMatchupResult
+	{
+		int32 Duels = 0;
+		int32 Wins = 0;
+		int32 Timeouts = 0;
+		double TotalTimeToKill = 0.0;
+		float MinTimeToKill = TNumericLimits<float>::Max();
+		float MaxTimeToKill = 0.0f;
+		double TotalDamageTaken = 0.0;
+		int32 Parries = 0;
+		int32 Blocks = 0;
+		double SimulatedSeconds = 0.0;
+	};
+
+	struct FDuelOutcome
+	{
+		bool bPlayerWon = false;
+		bool bTimedOut = false;
+		float Duration = 0.0f;
+		float DamageTaken = 0.0f;
+		int32 Parries = 0;
+		int32 Blocks = 0;
+	};
+
+	/**
+	 * One player-versus-enemy duel, mirroring UYomiCombatComponent and AYomiWeaponBase:
+	 * light attacks cost stamina and land half way through the swing, combos build per hit,
+	 * durability wears per hit, blocking is only possible between swings.
+	 */
+	FDuelOutcome RunDuel(const FWeaponData& Weapon, const FArmorProfile& Armor, const FEnemyProfile& Enemy,
+		const FPlayerProfile& Player, const FSettings& Settings, FRandomStream& Random)
+	{
+		FDuelOutcome Outcome;
+
+		float PlayerHealth = Player.MaxHealth;
+		float EnemyHealth = Enemy.MaxHealth;
+
+		int32 ComboCount = 0;
+		int32 Durability = Weapon.MaxDurability;
+
+		float AttackRemaining = 0.0f;
+		float AttackDuration = 0.0f;
+		bool bHitPending = false;
+
+		// Stagger the first enemy swing so duels do not all start in lock step
+		float EnemyAttackTimer = Enemy.AttackCooldown * Random.FRandRange(0.5f, 1.0f);
+
+		const float Dt = Settings.TimeStep;
+		const float AttackCost = YomiCombatRules::AttackStaminaCost(Weapon, false);
+		const float EnemyResistance = 0.0f;
+		const int32 EnemyDamageIndex = static_cast<int32>(Enemy.DamageType);
+
+		// Same closed-form stamina as AYomiCharacterBase, so spending and the regen delay behave identically
+		FYomiRegenStat Stamina;
+		Stamina.Set(Player.MaxStamina, Player.MaxStamina, 0.0f);
+		Stamina.Rate = Player.StaminaRegenRate;
+
+		float Time = 0.0f;
+		while (Time < Settings.MaxDuelTime)
+		{
+			Time += Dt;
+
+			// Player swing
+			if (AttackRemaining > 0.0f)
+			{
+				AttackRemaining -= Dt;
+				if (bHitPending && AttackRemaining <= AttackDuration * 0.5f)
+				{
+					bHitPending = false;
+
+					const float DurabilityPercent = Weapon.MaxDurability > 0 ? static_cast<float>(Durability) / Weapon.MaxDurability : 0.0f;
+					float Damage = YomiCombatRules::ResistedDamage(
+						YomiCombatRules::WeaponDamage(Weapon, ComboCount, DurabilityPercent, false, false, Player.DamageScale), EnemyResistance);
+					if (Weapon.SecondaryDamageType != EDamageType::None)
+					{
+						Damage += YomiCombatRules::ResistedDamage(Weapon.SecondaryDamageAmount, EnemyResistance);
+					}
+
+					EnemyHealth -= Damage;
+					ComboCount = YomiCombatRules::NextComboCount(ComboCount);
+					Durability = FMath::Max(0, Durability - 1);
+
+					if (EnemyHealth <= 0.0f)
+					{
+						Outcome.bPlayerWon = true;
+						break;
+					}
+				}
+			}
+			else if (Durability > 0 && Stamina.Spend(AttackCost, Player.MaxStamina, Time, Player.StaminaRegenDelay))
+			{
+				AttackDuration = YomiCombatRules::AttackDuration(Weapon, false);
+				AttackRemaining = AttackDuration;
+				bHitPending = true;
+			}
+
+			// Enemy swing
+			EnemyAttackTimer -= Dt;
+			if (EnemyAttackTimer <= 0.0f)
+			{
+				EnemyAttackTimer += Enemy.AttackCooldown;
+
+				float Incoming = Enemy.AttackDamage;
+				const bool bCanDefend = AttackRemaining <= 0.0f && Weapon.bCanBlock;
+				if (bCanDefend && Random.FRand() < Settings.DefendChance)
+				{
+					const bool bParry = Random.FRand() < Settings.ParryChance;
+					Incoming = YomiCombatRules::BlockedDamage(Incoming, Weapon, bParry);
+
+					if (bParry)
+					{
+						++Outcome.Parries;
+					}
+					else
+					{
+						++Outcome.Blocks;
+						Stamina.Spend(YomiCombatRules::BlockStaminaCostPerHit, Player.MaxStamina, Time, Player.StaminaRegenDelay);
+					}
+				}
+
+				const float Taken = YomiCombatRules::ResistedDamage(Incoming, Armor.Resistances[EnemyDamageIndex]);
+				PlayerHealth -= Taken;
+				Outcome.DamageTaken += Taken;
+
+				if (PlayerHealth <= 0.0f) break;
+			}
+		}
+
+		Outcome.Duration = Time;
+		Outcome.bTimedOut = !Outcome.bPlayerWon && PlayerHealth > 0.0f;
+		return Outcome;
+	}
+
+	/**
+	 * Best piece per slot of a tier, folded into one resistance table. Only physical and spirit
+	 * defense count, as those are the only armor stats the game turns into resistance.
+	 */
+	FArmorProfile MakeArmorProfile(const FString& Name, const TArray<FArmorData>& Pieces)
+	{
+		TMap<EArmorSlot, const FArmorData*> BestBySlot;
+		for (const FArmorData& Piece : Pieces)
+		{
+			const FArmorData*& Best = BestBySlot.FindOrAdd(Piece.Slot, nullptr);
+			if (!Best || Piece.PhysicalDefense + Piece.SpiritDefense > Best->PhysicalDefense + Best->SpiritDefense)
+			{
+				Best = &Piece;
+			}
+		}
+
+		float Physical = 0.0f, Spirit = 0.0f;
+		for (const TPair<EArmorSlot, const FArmorData*>& Pair : BestBySlot)
+		{
+			Physical += Pair.Value->PhysicalDefense;
+			Spirit += Pair.Value->SpiritDefense;
+		}
+
+		FArmorProfile Profile;
+		Profile.Name = Name;
+		Profile.Resistances[static_cast<int32>(EDamageType::Physical)] = YomiCombatRules::DefenseToResistance(Physical);
+		Profile.Resistances[static_cast<int32>(EDamageType::Spirit)] = YomiCombatRules::DefenseToResistance(Spirit);
+		return Profile;
+	}
+
+	void GatherEnemyProfiles(TArray<FEnemyProfile>& OutProfiles)
+	{
+		for (TObjectIterator<UClass> It; It; ++It)
+		{
+			UClass* Class = *It;
+			if (!Class->IsChildOf(AYomiEnemyBase::StaticClass())) continue;
+			if (Class->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists)) continue;
+
+			const AYomiEnemyBase* Defaults = Class->GetDefaultObject<AYomiEnemyBase>();
+
+			FEnemyProfile& Profile = OutProfiles.AddDefaulted_GetRef();
+			Profile.Name = Class->GetName();
+			Profile.MaxHealth = Defaults->GetMaxHealth();
+			Profile.AttackDamage = Defaults->GetAttackDamage();
+			Profile.DamageType = Defaults->GetAttackDamageType();
+			Profile.AttackCooldown = FMath::Max(Defaults->GetAttackCooldown(), 0.1f);
+		}
+
+		OutProfiles.Sort([](const FEnemyProfile& A, const FEnemyProfile& B) { return A.MaxHealth < B.MaxHealth; });
+	}
+}
+
+UYomiCombatSimCommandlet::UYomiCombatSimCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+
+	HelpDescription = TEXT("Simulates weapon/armor/enemy duels headlessly and reports time-to-kill and throughput.");
+	HelpUsage = TEXT("-run=YomiCombatSim -nullrhi [-Duels=N] [-Seed=N] [-TimeStep=S] [-MaxDuelTime=S] [-DefendChance=P] [-ParryChance=P] [-DamageScale=X] [-Csv=Path]");
+}
+
+int32 UYomiCombatSimCommandlet::Main(const FString& Params)
+{
+	using namespace YomiCombatSim;
+
+	FSettings Settings;
+	FParse::Value(*Params, TEXT("Duels="), Settings.DuelsPerMatchup);
+	FParse::Value(*Params, TEXT("Seed="), Settings.Seed);
+	FParse::Value(*Params, TEXT("TimeStep="), Settings.TimeStep);
+	FParse::Value(*Params, TEXT("MaxDuelTime="), Settings.MaxDuelTime);
+	FParse::Value(*Params, TEXT("DefendChance="), Settings.DefendChance);
+	FParse::Value(*Params, TEXT("ParryChance="), Settings.ParryChance);
+
+	FString CsvPath;
+	FParse::Value(*Params, TEXT("Csv="), CsvPath);
+
+	Settings.DuelsPerMatchup = FMath::Max(Settings.DuelsPerMatchup, 1);
+	Settings.TimeStep = FMath::Clamp(Settings.TimeStep, 0.001f, 0.1f);
+
+	// ========================================================================
+	// PROFILES
+	// ========================================================================
+
+	UYomiDataSubsystem* Data = NewObject<UYomiDataSubsystem>(GetTransientPackage());
+	Data->LoadDefaultData();
+
+	TArray<FWeaponData> Weapons;
+	for (uint8 Tier = static_cast<uint8>(EWeaponTier::Bamboo); Tier < static_cast<uint8>(EWeaponTier::MAX); ++Tier)
+	{
+		TArray<FWeaponData> TierWeapons = Data->GetAllWeaponsOfTier(static_cast<EWeaponTier>(Tier));
+		TierWeapons.Sort([](const FWeaponData& A, const FWeaponData& B) { return A.WeaponType < B.WeaponType; });
+		Weapons.Append(TierWeapons);
+	}
+
+	TArray<FArmorProfile> Armors;
+	Armors.Add(MakeArmorProfile(TEXT("Unarmored"), {}));
+	for (uint8 Tier = static_cast<uint8>(EArmorTier::Peasant); Tier < static_cast<uint8>(EArmorTier::MAX); ++Tier)
+	{
+		const EArmorTier ArmorTier = static_cast<EArmorTier>(Tier);
+		Armors.Add(MakeArmorProfile(StaticEnum<EArmorTier>()->GetNameStringByValue(Tier), Data->GetAllArmorOfTier(ArmorTier)));
+	}
+
+	TArray<FEnemyProfile> Enemies;
+	GatherEnemyProfiles(Enemies);
+
+	const AYomiPlayerCharacter* PlayerDefaults = GetDefault<AYomiPlayerCharacter>();
+	FPlayerProfile Player;
+	Player.MaxHealth = PlayerDefaults->GetMaxHealth();
+	Player.MaxStamina = PlayerDefaults->GetMaxStamina();
+	Player.StaminaRegenRate = PlayerDefaults->GetStaminaRegenRate();
+	Player.StaminaRegenDelay = PlayerDefaults->GetStaminaRegenDelay();
+	FParse::Value(*Params, TEXT("DamageScale="), Player.DamageScale);
+
+	if (Weapons.Num() == 0 || Enemies.Num() == 0)
+	{
+		UE_LOG(LogYomiCombat, Error, TEXT("Combat sim needs at least one weapon and one enemy class (%d weapons, %d enemies)"),
+			Weapons.Num(), Enemies.Num());
+		return 1;
+	}
+
+	TArray<FMatchup> Matchups;
+	Matchups.Reserve(Weapons.Num() * Armors.Num() * Enemies.Num());
+	for (int32 EnemyIndex = 0; EnemyIndex < Enemies.Num(); ++EnemyIndex)
+	{
+		for (int32 ArmorIndex = 0; ArmorIndex < Armors.Num(); ++ArmorIndex)
+		{
+			for (int32 WeaponIndex = 0; WeaponIndex < Weapons.Num(); ++WeaponIndex)
+			{
+				Matchups.Add({ WeaponIndex, ArmorIndex, EnemyIndex });
+			}
+		}
+	}
+
+	UE_LOG(LogYomiCombat, Display, TEXT("Simulating %d matchups x %d duels (%d weapons, %d armor sets, %d enemies), seed %d, step %.4fs"),
+		Matchups.Num(), Settings.DuelsPerMatchup, Weapons.Num(), Armors.Num(), Enemies.Num(), Settings.Seed, Settings.TimeStep);
+
+	// ========================================================================
+	// SIMULATION
+	// ========================================================================
+
+	TArray<FMatchupResult> Results;
+	Results.SetNum(Matchups.Num());
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// One matchup per task; every duel gets its own stream so results do not depend on scheduling
+	ParallelFor(Matchups.Num(), [&](int32 MatchupIndex)
+	{
+		const FMatchup& Matchup = Matchups[MatchupIndex];
+		FMatchupResult& Result = Results[MatchupIndex];
+
+		for (int32 Duel = 0; Duel < Settings.DuelsPerMatchup; ++Duel)
+		{
+			FRandomStream Random(HashCombine(static_cast<uint32>(Settings.Seed), GetTypeHash(MatchupIndex * Settings.DuelsPerMatchup + Duel)));
+			const FDuelOutcome Outcome = RunDuel(Weapons[Matchup.Weapon], Armors[Matchup.Armor], Enemies[Matchup.Enemy], Player, Settings, Random);
+
+			++Result.Duels;
+			Result.SimulatedSeconds += Outcome.Duration;
+			Result.TotalDamageTaken += Outcome.DamageTaken;
+			Result.Parries += Outcome.Parries;
+			Result.Blocks += Outcome.Blocks;
+
+			if (Outcome.bPlayerWon)
+			{
+				++Result.Wins;
+				Result.TotalTimeToKill += Outcome.Duration;
+				Result.MinTimeToKill = FMath::Min(Result.MinTimeToKill, Outcome.Duration);
+				Result.MaxTimeToKill = FMath::Max(Result.MaxTimeToKill, Outcome.Duration);
+			}
+			else if (Outcome.bTimedOut)
+			{
+				++Result.Timeouts;
+			}
+		}
+	});
+
+	const double Elapsed = FMath::Max(FPlatformTime::Seconds() - StartTime, 1e-6);
+
+	// ========================================================================
+	// REPORT
+	// ========================================================================
+
+	FString Csv = TEXT("Enemy,Armor,Weapon,Tier,Duels,WinRate,MeanTTK,MinTTK,MaxTTK,MeanDamageTaken,Timeouts,Parries,Blocks\n");
+
+	int64 TotalDuels = 0;
+	double TotalSimulated = 0.0;
+
+	int32 ResultIndex = 0;
+	for (int32 EnemyIndex = 0; EnemyIndex < Enemies.Num(); ++EnemyIndex)
+	{
+		for (int32 ArmorIndex = 0; ArmorIndex < Armors.Num(); ++ArmorIndex)
+		{
+			UE_LOG(LogYomiCombat, Display, TEXT(""));
+			UE_LOG(LogYomiCombat, Display, TEXT("=== %s vs player in %s ==="), *Enemies[EnemyIndex].Name, *Armors[ArmorIndex].Name);
+			UE_LOG(LogYomiCombat, Display, TEXT("%-24s %8s %9s %9s %9s %10s"), TEXT("Weapon"), TEXT("Win %"), TEXT("TTK avg"), TEXT("TTK min"), TEXT("TTK max"), TEXT("Dmg taken"));
+
+			for (int32 WeaponIndex = 0; WeaponIndex < Weapons.Num(); ++WeaponIndex, ++ResultIndex)
+			{
+				const FMatchupResult& Result = Results[ResultIndex];
+				const FWeaponData& Weapon = Weapons[WeaponIndex];
+
+				const float WinRate = Result.Duels > 0 ? 100.0f * Result.Wins / Result.Duels : 0.0f;
+				const float MeanTimeToKill = Result.Wins > 0 ? static_cast<float>(Result.TotalTimeToKill / Result.Wins) : 0.0f;
+				const float MinTimeToKill = Result.Wins > 0 ? Result.MinTimeToKill : 0.0f;
+				const float MeanDamageTaken = Result.Duels > 0 ? static_cast<float>(Result.TotalDamageTaken / Result.Duels) : 0.0f;
+				const FString WeaponName = Weapon.DisplayName.ToString();
+
+				UE_LOG(LogYomiCombat, Display, TEXT("%-24s %7.1f%% %8.2fs %8.2fs %8.2fs %10.1f"),
+					*WeaponName.Left(24), WinRate, MeanTimeToKill, MinTimeToKill, Result.MaxTimeToKill, MeanDamageTaken);
+
+				Csv += FString::Printf(TEXT("%s,%s,\"%s\",%s,%d,%.4f,%.3f,%.3f,%.3f,%.2f,%d,%d,%d\n"),
+					*Enemies[EnemyIndex].Name, *Armors[ArmorIndex].Name, *WeaponName,
+					*StaticEnum<EWeaponTier>()->GetNameStringByValue(static_cast<int64>(Weapon.Tier)),
+					Result.Duels, WinRate / 100.0f, MeanTimeToKill, MinTimeToKill, Result.MaxTimeToKill, MeanDamageTaken,
+					Result.Timeouts, Result.Parries, Result.Blocks);
+
+				TotalDuels += Result.Duels;
+				TotalSimulated += Result.SimulatedSeconds;
+			}
+		}
+	}
+
+	UE_LOG(LogYomiCombat, Display, TEXT(""));
+	UE_LOG(LogYomiCombat, Display, TEXT("Simulated %lld duels (%.0f combat seconds) in %.3fs on %d workers: %.0f duels/s, %.0fx real time"),
+		TotalDuels, TotalSimulated, Elapsed, FTaskGraphInterface::Get().GetNumWorkerThreads() + 1,
+		TotalDuels / Elapsed, TotalSimulated / Elapsed);
+
+	if (!CsvPath.IsEmpty())
+	{
+		if (FPaths::IsRelative(CsvPath))
+		{
+			CsvPath = FPaths::Combine(FPaths::ProjectDir(), CsvPath);
+		}
+
+		if (FFileHelper::SaveStringToFile(Csv, *CsvPath))
+		{
+			UE_LOG(LogYomiCombat, Display, TEXT("Wrote %s"), *CsvPath);
+		}
+		else
+		{
+			UE_LOG(LogYomiCombat, Error, TEXT("Could not write %s"), *CsvPath);
+			return 1;
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,246 @@
+// Copyright (c) 2026 Yomi Survival. All Rights Reserved.
+
+#include "Combat/YomiDamageSubsystem.h"
+#include "Character/YomiCharacterBase.h"
+#include "Character/YomiCharacterRegistry.h"
+#include "Stats/Stats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Resolve Damage Queue"), STAT_YomiResolveDamage, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Damage Events"), STAT_YomiDamageEvents, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Damaged Characters"), STAT_YomiDamagedCharacters, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Kills"), STAT_YomiKills, STATGROUP_Game);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Damage Dealt"), STAT_YomiDamageDealt, STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("Area Attack Query"), STAT_YomiAreaAttack, STATGROUP_Game);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Area Attack Targets"), STAT_YomiAreaTargets, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Knockbacks"), STAT_YomiKnockbacks, STATGROUP_Game);
+
+void UYomiDamageSubsystem::Deinitialize()
+{
+	Queue.Empty();
+	ResolvingEvents.Empty();
+	Results.Empty();
+	ResultIndices.Empty();
+	Knockbacks.Empty();
+	KnockbackIndices.Empty();
+	AreaCandidates.Empty();
+	Super::Deinitialize();
+}
+
+void UYomiDamageSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Queue.Num() > 0 || Knockbacks.Num() > 0)
+	{
+		FlushDamageQueue();
+	}
+}
+
+void UYomiDamageSubsystem::QueueDamage(AYomiCharacterBase* Target, float Amount, EDamageType DamageType, AActor* DamageCauser, EDamageSource Source)
+{
+	if (!Target || Amount <= 0.0f || !Target->HasAuthority()) return;
+
+	FDamageEvent& Event = Queue.AddDefaulted_GetRef();
+	Event.Target = Target;
+	Event.Causer = DamageCauser;
+	Event.Amount = Amount;
+	Event.DamageType = DamageType;
+	Event.Source = Source;
+}
+
+void UYomiDamageSubsystem::FlushDamageQueue()
+{
+	SCOPE_CYCLE_COUNTER(STAT_YomiResolveDamage);
+
+	FYomiCombatFrameStats Stats;
+	Stats.NumEvents = Queue.Num();
+
+	// Swap the queue out so damage reactions (death, thorns...) can queue into the next frame.
+	// Both buffers keep their allocations, so a steady fight stops allocating after warm-up.
+	ResolvingEvents.Reset();
+	Swap(Queue, ResolvingEvents);
+
+	Results.Reset();
+	ResultIndices.Reset();
+
+	// Resolve every hit against its target's running health, in the order they were queued
+	for (const FDamageEvent& Event : ResolvingEvents)
+	{
+		AYomiCharacterBase* Target = Event.Target.Get();
+		if (!Target || !Target->IsAlive())
+		{
+			++Stats.NumDiscarded;
+			continue;
+		}
+
+		int32& ResultIndex = ResultIndices.FindOrAdd(Target, INDEX_NONE);
+		if (ResultIndex == INDEX_NONE)
+		{
+			ResultIndex = Results.AddDefaulted();
+			Results[ResultIndex].Target = Target;
+			Results[ResultIndex].RemainingHealth = Target->GetCurrentHealth();
+		}
+
+		FTargetResult& Result = Results[ResultIndex];
+		if (Result.RemainingHealth <= 0.0f)
+		{
+			++Stats.NumDiscarded;
+			continue;
+		}
+
+		const float Resisted = Event.Amount * (1.0f - Target->GetDamageResistance(Event.DamageType));
+		const float Dealt = FMath::Min(Resisted, Result.RemainingHealth);
+
+		Result.RemainingHealth -= Dealt;
+		Result.TotalDamage += Dealt;
+		if (Dealt > Result.LargestHit)
+		{
+			Result.LargestHit = Dealt;
+			Result.LargestType = Event.DamageType;
+			Result.LargestCauser = Event.Causer.Get();
+		}
+
+		Stats.TotalDamage += Dealt;
+		Stats.DamageByType[static_cast<int32>(Event.DamageType)] += Dealt;
+		Stats.DamageBySource[static_cast<int32>(Event.Source)] += Dealt;
+	}
+
+	// Commit one health change and one round of notifications per character
+	for (const FTargetResult& Result : Results)
+	{
+		if (Result.TotalDamage <= 0.0f || !IsValid(Result.Target)) continue;
+
+		Result.Target->ApplyResolvedDamage(Result.TotalDamage, Result.LargestType, Result.LargestCauser);
+
+		++Stats.NumTargets;
+		if (!Result.Target->IsAlive())
+		{
+			++Stats.NumKills;
+		}
+	}
+
+	Stats.NumKnockbacks = Knockbacks.Num();
+	ApplyKnockbacks();
+
+	SET_DWORD_STAT(STAT_YomiDamageEvents, Stats.NumEvents);
+	SET_DWORD_STAT(STAT_YomiDamagedCharacters, Stats.NumTargets);
+	SET_DWORD_STAT(STAT_YomiKills, Stats.NumKills);
+	SET_FLOAT_STAT(STAT_YomiDamageDealt, Stats.TotalDamage);
+	SET_DWORD_STAT(STAT_YomiKnockbacks, Stats.NumKnockbacks);
+
+	UE_LOG(LogYomiCombat, VeryVerbose, TEXT("Resolved %d damage events: %d characters, %d kills, %.1f damage"),
+		Stats.NumEvents, Stats.NumTargets, Stats.NumKills, Stats.TotalDamage);
+
+	LastFrameStats = Stats;
+	OnCombatFrameResolved.Broadcast(LastFrameStats);
+}
+
+// ============================================================================
+// AREA ATTACKS
+// ============================================================================
+
+int32 UYomiDamageSubsystem::QueueAreaAttack(const FYomiAreaAttack& Attack, const FVector& Origin, const FVector& Forward, float Damage,
+	EDamageType DamageType, AYomiCharacterBase* Instigator, AActor* DamageCauser, EDamageSource Source, TArray<AYomiCharacterBase*>* OutTargets)
+{
+	SCOPE_CYCLE_COUNTER(STAT_YomiAreaAttack);
+
+	const UYomiCharacterRegistry* Registry = GetWorld()->GetSubsystem<UYomiCharacterRegistry>();
+	if (!Registry || Attack.Shape == EYomiAreaShape::None || Attack.Radius <= 0.0f) return 0;
+	if (Instigator && !Instigator->HasAuthority()) return 0;
+
+	FYomiCharacterFilter Filter;
+	Filter.IgnoreActor = Instigator;
+	Filter.ExcludeAlliesOf = Instigator ? Instigator->GetTeam() : EYomiTeam::None;
+
+	// Arcs and rings are flat cylinders; query the sphere around them and trim below
+	const bool bFlat = Attack.Shape != EYomiAreaShape::Cone;
+	const float QueryRadius = bFlat ? FVector2D(Attack.Radius, Attack.HeightTolerance).Size() : Attack.Radius;
+
+	AreaCandidates.Reset();
+	Registry->GatherInRadius(Origin, QueryRadius, Filter, AreaCandidates);
+
+	const FVector Axis = bFlat ? Forward.GetSafeNormal2D() : Forward.GetSafeNormal();
+	const float CosHalfAngle = FMath::Cos(FMath::DegreesToRadians(FMath::Clamp(Attack.HalfAngleDegrees, 0.0f, 180.0f)));
+	const float RadiusSq = FMath::Square(Attack.Radius);
+	const float InnerRadiusSq = FMath::Square(Attack.InnerRadius);
+	const float AreaDamage = Damage * Attack.DamageScale;
+	const bool bKnockback = Attack.KnockbackForce > 0.0f || Attack.KnockbackUpward > 0.0f;
+
+	int32 NumTargets = 0;
+	for (AYomiCharacterBase* Target : AreaCandidates)
+	{
+		FVector Offset = Target->GetActorLocation() - Origin;
+		if (bFlat)
+		{
+			if (FMath::Abs(Offset.Z) > Attack.HeightTolerance) continue;
+			Offset.Z = 0.0f;
+		}
+
+		const float DistSq = Offset.SizeSquared();
+		if (DistSq > RadiusSq) continue;
+
+		const float Dist = FMath::Sqrt(DistSq);
+		const FVector Direction = Dist > KINDA_SMALL_NUMBER ? Offset / Dist : Axis;
+
+		if (Attack.Shape == EYomiAreaShape::Ring)
+		{
+			if (DistSq < InnerRadiusSq) continue;
+		}
+		else if (Dist > KINDA_SMALL_NUMBER && FVector::DotProduct(Axis, Direction) < CosHalfAngle)
+		{
+			continue;
+		}
+
+		QueueDamage(Target, AreaDamage, DamageType, DamageCauser, Source);
+
+		if (bKnockback)
+		{
+			// Push straight away from the origin, weaker towards the edge
+			const float Scale = FMath::Lerp(1.0f, Attack.KnockbackFalloff, Dist / Attack.Radius);
+			const FVector Push = Direction.GetSafeNormal2D() * Attack.KnockbackForce + FVector(0.0f, 0.0f, Attack.KnockbackUpward);
+			QueueKnockback(Target, Push * Scale);
+		}
+
+		if (OutTargets)
+		{
+			OutTargets->Add(Target);
+		}
+		++NumTargets;
+	}
+
+	INC_DWORD_STAT_BY(STAT_YomiAreaTargets, NumTargets);
+
+	UE_LOG(LogYomiCombat, Verbose, TEXT("Area attack from %s hit %d of %d candidates"),
+		Instigator ? *Instigator->GetName() : TEXT("world"), NumTargets, AreaCandidates.Num());
+
+	return NumTargets;
+}
+
+void UYomiDamageSubsystem::QueueKnockback(AYomiCharacterBase* Target, const FVector& LaunchVelocity)
+{
+	if (!Target || LaunchVelocity.IsNearlyZero() || !Target->HasAuthority()) return;
+
+	int32& Index = KnockbackIndices.FindOrAdd(Target, INDEX_NONE);
+	if (Index == INDEX_NONE)
+	{
+		Index = Knockbacks.AddDefaulted();
+		Knockbacks[Index].Target = Target;
+	}
+	Knockbacks[Index].LaunchVelocity += LaunchVelocity;
+}
+
+void UYomiDamageSubsystem::ApplyKnockbacks()
+{
+	// Launching can trigger movement callbacks that queue more pushes; those wait for the next frame
+	TArray<FKnockback> Pending = MoveTemp(Knockbacks);
+	Knockbacks.Reset();
+	KnockbackIndices.Reset();
+
+	for (const FKnockback& Knockback : Pending)
+	{
+		AYomiCharacterBase* Target = Knockback.Target.Get();
+		if (!Target || !Target->IsAlive()) continue;
+
+		Target->LaunchCharacter(Knockback.LaunchVelocity, true, Knockback.LaunchVelocity.Z > 0.0f);
+	}
+}
@@ -0,0 +1,217 @@
+// Copyright (c) 2026 Yomi Survival. All Rights Reserved.
+
+#include "Combat/YomiLagCompensationSubsystem.h"
+#include "Character/YomiCharacterBase.h"
+#include "Components/CapsuleComponent.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerState.h"
+#include "Stats/Stats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Sample Hitbox History"), STAT_YomiSampleHitboxes, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Hits Validated"), STAT_YomiHitsValidated, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Hits Rejected"), STAT_YomiHitsRejected, STATGROUP_Game);
+
+void FYomiHitboxSample::GetSegment(FVector& OutA, FVector& OutB) const
+{
+	const FVector Axis = Rotation.GetUpVector() * FMath::Max(HalfHeight - Radius, 0.0f);
+	OutA = Location - Axis;
+	OutB = Location + Axis;
+}
+
+void UYomiLagCompensationSubsystem::Deinitialize()
+{
+	Samples.Empty();
+	Tracks.Empty();
+	FreeSlots.Empty();
+	SlotIndices.Empty();
+	Super::Deinitialize();
+}
+
+void UYomiLagCompensationSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// Only a server with remote clients has anything to rewind
+	const UWorld* World = GetWorld();
+	if (!World || World->GetNetMode() == NM_Client || World->GetNetMode() == NM_Standalone) return;
+
+	// One sample per net tick, unless the server runs so fast that HistoryLength
+	// samples would no longer reach back MaxRewindTime
+	const float MaxRate = (HistoryLength - 1) / FMath::Max(MaxRewindTime, KINDA_SMALL_NUMBER);
+	const float Rate = SampleRate > 0.0f ? FMath::Min(SampleRate, MaxRate) : MaxRate;
+
+	TimeSinceSample += DeltaTime;
+	const float Interval = 1.0f / Rate;
+	if (TimeSinceSample < Interval) return;
+
+	TimeSinceSample = FMath::Fmod(TimeSinceSample, Interval);
+	SampleAll(World->GetTimeSeconds());
+}
+
+// ============================================================================
+// TRACKING
+// ============================================================================
+
+void UYomiLagCompensationSubsystem::RegisterCharacter(AYomiCharacterBase* Character)
+{
+	if (!Character || SlotIndices.Contains(Character)) return;
+
+	int32 Slot;
+	if (FreeSlots.Num() > 0)
+	{
+		Slot = FreeSlots.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		Slot = Tracks.AddDefaulted();
+		Samples.AddDefaulted(HistoryLength);
+	}
+
+	FTrack& Track = Tracks[Slot];
+	Track.Character = Character;
+	Track.Head = INDEX_NONE;
+	Track.NumSamples = 0;
+
+	SlotIndices.Add(Character, Slot);
+}
+
+void UYomiLagCompensationSubsystem::UnregisterCharacter(AYomiCharacterBase* Character)
+{
+	int32 Slot;
+	if (SlotIndices.RemoveAndCopyValue(Character, Slot))
+	{
+		Tracks[Slot] = FTrack();
+		FreeSlots.Add(Slot);
+	}
+}
+
+void UYomiLagCompensationSubsystem::SampleAll(float Now)
+{
+	SCOPE_CYCLE_COUNTER(STAT_YomiSampleHitboxes);
+
+	for (int32 Slot = 0; Slot < Tracks.Num(); ++Slot)
+	{
+		FTrack& Track = Tracks[Slot];
+		const AYomiCharacterBase* Character = Track.Character.Get();
+		if (!Character) continue;
+
+		const UCapsuleComponent* Capsule = Character->GetCapsuleComponent();
+
+		Track.Head = (Track.Head + 1) % HistoryLength;
+		Track.NumSamples = FMath::Min(Track.NumSamples + 1, HistoryLength);
+
+		FYomiHitboxSample& Sample = Samples[BlockStart(Slot) + Track.Head];
+		Sample.Time = Now;
+		Sample.Location = Capsule->GetComponentLocation();
+		Sample.Rotation = Capsule->GetComponentQuat();
+		Sample.Radius = Capsule->GetScaledCapsuleRadius();
+		Sample.HalfHeight = Capsule->GetScaledCapsuleHalfHeight();
+	}
+}
+
+// ============================================================================
+// VALIDATION
+// ============================================================================
+
+bool UYomiLagCompensationSubsystem::RewindCharacter(const AYomiCharacterBase* Character, float Time, FYomiHitboxSample& OutSample) const
+{
+	const int32* SlotPtr = SlotIndices.Find(Character);
+	if (!SlotPtr) return false;
+
+	const FTrack& Track = Tracks[*SlotPtr];
+	const FYomiHitboxSample* Block = Samples.GetData() + BlockStart(*SlotPtr);
+
+	// Nothing recorded yet, or asking about a moment after the last sample: use the live capsule
+	if (Track.NumSamples == 0 || Time >= Block[Track.Head].Time)
+	{
+		const UCapsuleComponent* Capsule = Character->GetCapsuleComponent();
+		OutSample.Time = Time;
+		OutSample.Location = Capsule->GetComponentLocation();
+		OutSample.Rotation = Capsule->GetComponentQuat();
+		OutSample.Radius = Capsule->GetScaledCapsuleRadius();
+		OutSample.HalfHeight = Capsule->GetScaledCapsuleHalfHeight();
+		return true;
+	}
+
+	// Walk back from the newest sample to the pair that brackets Time
+	int32 Newer = Track.Head;
+	for (int32 Step = 1; Step < Track.NumSamples; ++Step)
+	{
+		const int32 Older = (Track.Head - Step + HistoryLength) % HistoryLength;
+		const FYomiHitboxSample& A = Block[Older];
+		const FYomiHitboxSample& B = Block[Newer];
+
+		if (A.Time <= Time)
+		{
+			const float Span = B.Time - A.Time;
+			const float Alpha = Span > KINDA_SMALL_NUMBER ? (Time - A.Time) / Span : 1.0f;
+
+			OutSample.Time = Time;
+			OutSample.Location = FMath::Lerp(A.Location, B.Location, Alpha);
+			OutSample.Rotation = FQuat::FastLerp(A.Rotation, B.Rotation, Alpha).GetNormalized();
+			OutSample.Radius = FMath::Lerp(A.Radius, B.Radius, Alpha);
+			OutSample.HalfHeight = FMath::Lerp(A.HalfHeight, B.HalfHeight, Alpha);
+			return true;
+		}
+
+		Newer = Older;
+	}
+
+	// Older than the whole history: the oldest pose is the best we have
+	OutSample = Block[Newer];
+	return true;
+}
+
+bool UYomiLagCompensationSubsystem::ValidateHit(const AYomiCharacterBase* Target, const FVector& Start, const FVector& End,
+	float QueryRadius, float ClientTime) const
+{
+	const UWorld* World = GetWorld();
+	if (!Target || !World) return false;
+
+	const float Now = World->GetTimeSeconds();
+	const float RewindTime = FMath::Clamp(ClientTime, Now - MaxRewindTime, Now);
+
+	FYomiHitboxSample Sample;
+	if (!RewindCharacter(Target, RewindTime, Sample))
+	{
+		// Untracked characters (e.g. just spawned) are judged by where they are now
+		RewindCharacter(Target, Now, Sample);
+	}
+
+	FVector CapsuleA, CapsuleB;
+	Sample.GetSegment(CapsuleA, CapsuleB);
+
+	FVector OnQuery, OnCapsule;
+	FMath::SegmentDistToSegmentSafe(Start, End, CapsuleA, CapsuleB, OnQuery, OnCapsule);
+
+	const float Reach = Sample.Radius + QueryRadius + HitTolerance;
+	const bool bValid = FVector::DistSquared(OnQuery, OnCapsule) <= Reach * Reach;
+
+	if (bValid)
+	{
+		INC_DWORD_STAT(STAT_YomiHitsValidated);
+	}
+	else
+	{
+		INC_DWORD_STAT(STAT_YomiHitsRejected);
+		UE_LOG(LogYomiCombat, Verbose, TEXT("Rejected hit on %s rewound %.0f ms (miss by %.1f)"),
+			*Target->GetName(), (Now - RewindTime) * 1000.0f, FVector::Dist(OnQuery, OnCapsule) - Reach);
+	}
+
+	return bValid;
+}
+
+float UYomiLagCompensationSubsystem::GetViewTimestamp(const APawn* Viewer)
+{
+	const UWorld* World = Viewer ? Viewer->GetWorld() : nullptr;
+	if (!World) return 0.0f;
+
+	const AGameStateBase* GameState = World->GetGameState();
+	const float ServerTime = GameState ? GameState->GetServerWorldTimeSeconds() : World->GetTimeSeconds();
+
+	// Remote characters reach this client half a round trip after the server moved them
+	const APlayerState* PlayerState = Viewer->GetPlayerState();
+	const float HalfRoundTrip = PlayerState ? PlayerState->GetPingInMilliseconds() * 0.0005f : 0.0f;
+
+	return ServerTime - HalfRoundTrip;
+}
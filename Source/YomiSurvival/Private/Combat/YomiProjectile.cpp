@@ -2,10 +2,14 @@
 
 #include "Combat/YomiProjectile.h"
 #include "Character/YomiCharacterBase.h"
+#include "Combat/YomiDamageSubsystem.h"
+#include "Combat/YomiProjectileSubsystem.h"
+#include "Core/YomiActorPoolSubsystem.h"
 #include "Components/SphereComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "GameFramework/ProjectileMovementComponent.h"
 #include "NiagaraComponent.h"
+#include "Engine/Engine.h"
 
 AYomiProjectile::AYomiProjectile()
 {
@@ -44,6 +48,47 @@ void AYomiProjectile::BeginPlay()
 	CollisionComponent->OnComponentBeginOverlap.AddDynamic(this, &AYomiProjectile::OnOverlap);
 }
 
+AYomiProjectile* AYomiProjectile::SpawnProjectile(UObject* WorldContextObject, TSubclassOf<AYomiProjectile> ProjectileClass, const FTransform& Transform,
+	APawn* InstigatorPawn, float InDamage, EDamageType InDamageType, float InSpeed)
+{
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+	if (!World || !ProjectileClass) return nullptr;
+
+	AYomiProjectile* Projectile = nullptr;
+	if (UYomiActorPoolSubsystem* Pool = World->GetSubsystem<UYomiActorPoolSubsystem>())
+	{
+		Projectile = Pool->AcquireActor<AYomiProjectile>(ProjectileClass, Transform, InstigatorPawn, InstigatorPawn);
+	}
+	else
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.Owner = InstigatorPawn;
+		SpawnParams.Instigator = InstigatorPawn;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		Projectile = World->SpawnActor<AYomiProjectile>(ProjectileClass, Transform, SpawnParams);
+	}
+
+	if (Projectile)
+	{
+		Projectile->InitializeProjectile(InDamage, InDamageType, InSpeed);
+	}
+	return Projectile;
+}
+
+void AYomiProjectile::OnAcquiredFromPool()
+{
+	// A stopped projectile movement drops its updated component
+	ProjectileMovement->SetUpdatedComponent(CollisionComponent);
+	ProjectileMovement->Activate(true);
+
+	// The pool, not the actor lifespan, ends a pooled flight
+	SetLifeSpan(0.0f);
+	if (UYomiActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UYomiActorPoolSubsystem>())
+	{
+		Pool->ReleaseActorAfter(this, LifeSpan);
+	}
+}
+
 void AYomiProjectile::InitializeProjectile(float InDamage, EDamageType InDamageType, float InSpeed)
 {
 	Damage = InDamage;
@@ -57,6 +102,31 @@ void AYomiProjectile::InitializeProjectile(float InDamage, EDamageType InDamageT
 	}
 }
 
+UStaticMesh* AYomiProjectile::GetProjectileMesh() const
+{
+	return MeshComponent ? MeshComponent->GetStaticMesh() : nullptr;
+}
+
+FTransform AYomiProjectile::GetMeshRelativeTransform() const
+{
+	return MeshComponent ? MeshComponent->GetRelativeTransform() : FTransform::Identity;
+}
+
+float AYomiProjectile::GetCollisionRadius() const
+{
+	return CollisionComponent ? CollisionComponent->GetUnscaledSphereRadius() : 10.0f;
+}
+
+float AYomiProjectile::GetGravityScale() const
+{
+	return ProjectileMovement ? ProjectileMovement->ProjectileGravityScale : 1.0f;
+}
+
+UNiagaraSystem* AYomiProjectile::GetTrailSystem() const
+{
+	return TrailEffect ? TrailEffect->GetAsset() : nullptr;
+}
+
 void AYomiProjectile::OnHit(UPrimitiveComponent* HitComp, AActor* OtherActor,
 	UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit)
 {
@@ -65,20 +135,22 @@ void AYomiProjectile::OnHit(UPrimitiveComponent* HitComp, AActor* OtherActor,
 	AYomiCharacterBase* HitCharacter = Cast<AYomiCharacterBase>(OtherActor);
 	if (HitCharacter)
 	{
-		HitCharacter->ApplyDamage(Damage, ProjectileDamageType, GetInstigator());
+		if (UYomiDamageSubsystem* DamageSubsystem = GetWorld()->GetSubsystem<UYomiDamageSubsystem>())
+		{
+			DamageSubsystem->QueueDamage(HitCharacter, Damage, ProjectileDamageType, GetInstigator(), EDamageSource::Projectile);
+		}
 	}
 
+	// What stays behind is an instance in the projectile subsystem, not this actor
 	if (bShouldStick)
 	{
-		ProjectileMovement->StopMovementImmediately();
-		AttachToComponent(OtherComp, FAttachmentTransformRules::KeepWorldTransform);
-		CollisionComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-		SetLifeSpan(10.0f);
-	}
-	else
-	{
-		Destroy();
+		if (UYomiProjectileSubsystem* ProjectileSubsystem = GetWorld()->GetSubsystem<UYomiProjectileSubsystem>())
+		{
+			ProjectileSubsystem->StickProjectile(GetClass(), Hit, GetActorQuat());
+		}
 	}
+
+	Retire();
 }
 
 void AYomiProjectile::OnOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
@@ -89,7 +161,24 @@ void AYomiProjectile::OnOverlap(UPrimitiveComponent* OverlappedComponent, AActor
 	AYomiCharacterBase* HitCharacter = Cast<AYomiCharacterBase>(OtherActor);
 	if (HitCharacter)
 	{
-		HitCharacter->ApplyDamage(Damage, ProjectileDamageType, GetInstigator());
+		if (UYomiDamageSubsystem* DamageSubsystem = GetWorld()->GetSubsystem<UYomiDamageSubsystem>())
+		{
+			DamageSubsystem->QueueDamage(HitCharacter, Damage, ProjectileDamageType, GetInstigator(), EDamageSource::Projectile);
+		}
+		Retire();
+	}
+}
+
+void AYomiProjectile::Retire()
+{
+	ProjectileMovement->StopMovementImmediately();
+
+	if (UYomiActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UYomiActorPoolSubsystem>())
+	{
+		Pool->ReleaseActor(this);
+	}
+	else
+	{
 		Destroy();
 	}
 }
@@ -0,0 +1,513 @@
+// Copyright (c) 2026 Yomi Survival. All Rights Reserved.
+
+#include "Combat/YomiProjectileSubsystem.h"
+#include "Combat/YomiProjectile.h"
+#include "Combat/YomiDamageSubsystem.h"
+#include "Combat/YomiStatusEffectSubsystem.h"
+#include "Character/YomiCharacterBase.h"
+#include "Core/YomiGameState.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "NiagaraComponent.h"
+#include "NiagaraFunctionLibrary.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Simulate Projectiles"), STAT_YomiSimulateProjectiles, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Stuck Projectiles"), STAT_YomiStuckProjectiles, STATGROUP_Game);
+
+void UYomiProjectileSubsystem::Deinitialize()
+{
+	// The world is going away along with its effect pool, so just drop the state
+	Positions.Empty();
+	Velocities.Empty();
+	TimeRemaining.Empty();
+	Damages.Empty();
+	DamageTypes.Empty();
+	ArchetypeIndices.Empty();
+	Flags.Empty();
+	Instigators.Empty();
+	StatusInflictions.Empty();
+	Trails.Empty();
+
+	StuckArchetypes.Empty();
+	StuckParents.Empty();
+	StuckBones.Empty();
+	StuckOffsets.Empty();
+	StuckExpiryTimes.Empty();
+	StuckOwners.Empty();
+	StuckSerials.Empty();
+	StuckCounts.Empty();
+
+	if (VisualsActor)
+	{
+		VisualsActor->Destroy();
+		VisualsActor = nullptr;
+	}
+
+	Archetypes.Empty();
+	PendingLaunches.Empty();
+	Super::Deinitialize();
+}
+
+void UYomiProjectileSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	// Everything launched this frame goes out to clients in one RPC
+	if (PendingLaunches.Num() > 0)
+	{
+		if (AYomiGameState* GameState = World->GetGameState<AYomiGameState>())
+		{
+			GameState->MulticastProjectilesFired(PendingLaunches);
+		}
+		PendingLaunches.Reset();
+	}
+
+	// Still update visuals on the frame the last projectile goes, so its instance is cleared
+	if (Positions.Num() == 0 && StuckParents.Num() == 0) return;
+
+	if (Positions.Num() > 0)
+	{
+		Simulate(DeltaTime);
+	}
+
+	if (StuckParents.Num() > 0)
+	{
+		ExpireStuckProjectiles();
+	}
+
+	SET_DWORD_STAT(STAT_YomiStuckProjectiles, StuckParents.Num());
+
+	if (ShouldRenderVisuals())
+	{
+		UpdateVisuals();
+	}
+}
+
+// ============================================================================
+// LAUNCHING
+// ============================================================================
+
+void UYomiProjectileSubsystem::LaunchProjectile(TSubclassOf<AYomiProjectile> Archetype, const FVector& Origin, const FVector& Direction,
+	float Speed, float Damage, EDamageType DamageType, AActor* Instigator, const FYomiStatusInfliction& OnHitStatus)
+{
+	UWorld* World = GetWorld();
+	if (!World || World->GetNetMode() == NM_Client || !Archetype) return;
+
+	const FVector LaunchDirection = Direction.GetSafeNormal();
+	if (LaunchDirection.IsZero() || Speed <= 0.0f) return;
+
+	const int32 ArchetypeIndex = FindOrAddArchetype(Archetype);
+	AddProjectile(ArchetypeIndex, Origin, LaunchDirection * Speed, Damage, DamageType, Instigator, PF_None, OnHitStatus);
+
+	if (World->GetNetMode() != NM_Standalone)
+	{
+		FYomiProjectileLaunch& Launch = PendingLaunches.AddDefaulted_GetRef();
+		Launch.Archetype = Archetype;
+		Launch.Origin = Origin;
+		Launch.Direction = LaunchDirection;
+		Launch.Speed = Speed;
+		Launch.Instigator = Instigator;
+	}
+}
+
+void UYomiProjectileSubsystem::HandleLaunchBatch(const TArray<FYomiProjectileLaunch>& Launches)
+{
+	// The server simulates the real projectiles; only clients need cosmetic copies
+	if (!GetWorld() || GetWorld()->GetNetMode() != NM_Client) return;
+
+	for (const FYomiProjectileLaunch& Launch : Launches)
+	{
+		if (!Launch.Archetype) continue;
+
+		const int32 ArchetypeIndex = FindOrAddArchetype(Launch.Archetype);
+		AddProjectile(ArchetypeIndex, Launch.Origin, FVector(Launch.Direction) * Launch.Speed, 0.0f, EDamageType::None, Launch.Instigator, PF_Cosmetic);
+	}
+}
+
+int32 UYomiProjectileSubsystem::FindOrAddArchetype(TSubclassOf<AYomiProjectile> Class)
+{
+	for (int32 Index = 0; Index < Archetypes.Num(); ++Index)
+	{
+		if (Archetypes[Index].Class == Class.Get())
+		{
+			return Index;
+		}
+	}
+
+	const AYomiProjectile* Defaults = Class->GetDefaultObject<AYomiProjectile>();
+
+	FYomiProjectileArchetype& Archetype = Archetypes.AddDefaulted_GetRef();
+	Archetype.Class = Class.Get();
+	Archetype.Mesh = Defaults->GetProjectileMesh();
+	Archetype.MeshTransform = Defaults->GetMeshRelativeTransform();
+	Archetype.Radius = Defaults->GetCollisionRadius();
+	Archetype.GravityScale = Defaults->GetGravityScale();
+	Archetype.LifeSpan = Defaults->GetProjectileLifeSpan();
+	Archetype.bShouldStick = Defaults->ShouldStick();
+	Archetype.TrailEffect = Defaults->GetTrailSystem();
+	Archetype.ImpactEffect = Defaults->GetImpactEffect();
+
+	return Archetypes.Num() - 1;
+}
+
+int32 UYomiProjectileSubsystem::AddProjectile(int32 ArchetypeIndex, const FVector& Origin, const FVector& Velocity, float Damage,
+	EDamageType DamageType, AActor* Instigator, uint8 InFlags, const FYomiStatusInfliction& OnHitStatus)
+{
+	const FYomiProjectileArchetype& Archetype = Archetypes[ArchetypeIndex];
+
+	const int32 Index = Positions.Add(Origin);
+	Velocities.Add(Velocity);
+	TimeRemaining.Add(Archetype.LifeSpan);
+	Damages.Add(Damage);
+	DamageTypes.Add(DamageType);
+	ArchetypeIndices.Add(static_cast<uint16>(ArchetypeIndex));
+	Flags.Add(InFlags);
+	Instigators.Add(Instigator);
+	StatusInflictions.Add(OnHitStatus);
+
+	UNiagaraComponent* Trail = nullptr;
+	if (Archetype.TrailEffect && ShouldRenderVisuals())
+	{
+		Trail = UNiagaraFunctionLibrary::SpawnSystemAtLocation(GetWorld(), Archetype.TrailEffect, Origin, Velocity.Rotation(),
+			FVector::OneVector, false, true, ENCPoolMethod::ManualRelease);
+	}
+	Trails.Add(Trail);
+
+	return Index;
+}
+
+void UYomiProjectileSubsystem::RemoveProjectileAt(int32 Index)
+{
+	if (UNiagaraComponent* Trail = Trails[Index])
+	{
+		// Lets the trail fade out before it goes back to the pool
+		Trail->Deactivate();
+		Trail->ReleaseToPool();
+	}
+
+	Positions.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Velocities.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	TimeRemaining.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Damages.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	DamageTypes.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	ArchetypeIndices.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Flags.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Instigators.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	StatusInflictions.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Trails.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+// ============================================================================
+// SIMULATION
+// ============================================================================
+
+void UYomiProjectileSubsystem::Simulate(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_YomiSimulateProjectiles);
+
+	UWorld* World = GetWorld();
+	const int32 Count = Positions.Num();
+	const float GravityZ = World->GetGravityZ();
+
+	// Integrate every projectile first, producing the segment each one travels this frame
+	TArray<FVector, TInlineAllocator<64>> SweepEnds;
+	SweepEnds.SetNumUninitialized(Count);
+
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		TimeRemaining[Index] -= DeltaTime;
+
+		FVector& Velocity = Velocities[Index];
+		Velocity.Z += GravityZ * Archetypes[ArchetypeIndices[Index]].GravityScale * DeltaTime;
+		SweepEnds[Index] = Positions[Index] + Velocity * DeltaTime;
+	}
+
+	// Then sweep each one in turn, reusing a single query setup
+	FCollisionObjectQueryParams ObjectParams;
+	ObjectParams.AddObjectTypesToQuery(ECC_WorldStatic);
+	ObjectParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+	ObjectParams.AddObjectTypesToQuery(ECC_Pawn);
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(YomiProjectileSweep), false);
+	const AActor* IgnoredInstigator = nullptr;
+
+	TArray<TPair<int32, FHitResult>, TInlineAllocator<8>> Impacts;
+
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		const AActor* Instigator = Instigators[Index].Get();
+		if (Instigator != IgnoredInstigator)
+		{
+			QueryParams.ClearIgnoredActors();
+			QueryParams.AddIgnoredActor(Instigator);
+			IgnoredInstigator = Instigator;
+		}
+
+		FHitResult Hit;
+		const FCollisionShape Shape = FCollisionShape::MakeSphere(Archetypes[ArchetypeIndices[Index]].Radius);
+		if (World->SweepSingleByObjectType(Hit, Positions[Index], SweepEnds[Index], FQuat::Identity, ObjectParams, Shape, QueryParams))
+		{
+			Impacts.Emplace(Index, MoveTemp(Hit));
+		}
+		else
+		{
+			Positions[Index] = SweepEnds[Index];
+		}
+	}
+
+	// Resolve from the back so swap-removal never moves an unprocessed projectile
+	for (int32 ImpactIndex = Impacts.Num() - 1; ImpactIndex >= 0; --ImpactIndex)
+	{
+		ResolveImpact(Impacts[ImpactIndex].Key, Impacts[ImpactIndex].Value);
+	}
+
+	for (int32 Index = Positions.Num() - 1; Index >= 0; --Index)
+	{
+		if (TimeRemaining[Index] <= 0.0f)
+		{
+			RemoveProjectileAt(Index);
+		}
+	}
+}
+
+void UYomiProjectileSubsystem::ResolveImpact(int32 Index, const FHitResult& Hit)
+{
+	const FYomiProjectileArchetype& Archetype = Archetypes[ArchetypeIndices[Index]];
+	AYomiCharacterBase* HitCharacter = Cast<AYomiCharacterBase>(Hit.GetActor());
+
+	if (HitCharacter && !(Flags[Index] & PF_Cosmetic))
+	{
+		if (UYomiDamageSubsystem* DamageSubsystem = GetWorld()->GetSubsystem<UYomiDamageSubsystem>())
+		{
+			DamageSubsystem->QueueDamage(HitCharacter, Damages[Index], DamageTypes[Index], Instigators[Index].Get(), EDamageSource::Projectile);
+		}
+
+		if (StatusInflictions[Index].Effect != EYomiStatusEffect::None)
+		{
+			if (UYomiStatusEffectSubsystem* StatusEffects = GetWorld()->GetSubsystem<UYomiStatusEffectSubsystem>())
+			{
+				StatusEffects->ApplyInfliction(HitCharacter, StatusInflictions[Index], Instigators[Index].Get());
+			}
+		}
+	}
+
+	if (Archetype.ImpactEffect && ShouldRenderVisuals())
+	{
+		UNiagaraFunctionLibrary::SpawnSystemAtLocation(GetWorld(), Archetype.ImpactEffect, Hit.ImpactPoint, Hit.ImpactNormal.Rotation(),
+			FVector::OneVector, true, true, ENCPoolMethod::AutoRelease);
+	}
+
+	// The flight ends here either way; a stuck projectile lives on as a render-only entry
+	if (Archetype.bShouldStick && ShouldRenderVisuals())
+	{
+		AddStuckProjectile(ArchetypeIndices[Index], Hit, Velocities[Index].ToOrientationQuat());
+	}
+
+	RemoveProjectileAt(Index);
+}
+
+// ============================================================================
+// STUCK PROJECTILES
+// ============================================================================
+
+void UYomiProjectileSubsystem::StickProjectile(TSubclassOf<AYomiProjectile> Archetype, const FHitResult& Hit, const FQuat& Orientation)
+{
+	if (!Archetype || !ShouldRenderVisuals()) return;
+
+	AddStuckProjectile(FindOrAddArchetype(Archetype), Hit, Orientation);
+}
+
+void UYomiProjectileSubsystem::AddStuckProjectile(int32 ArchetypeIndex, const FHitResult& Hit, const FQuat& Orientation)
+{
+	AActor* HitActor = Hit.GetActor();
+	USceneComponent* Parent = Hit.GetComponent();
+	FName Bone = Hit.BoneName;
+
+	// Sweeps stop on a character's capsule; ride the nearest bone of its mesh instead
+	if (AYomiCharacterBase* HitCharacter = Cast<AYomiCharacterBase>(HitActor))
+	{
+		USkeletalMeshComponent* Mesh = HitCharacter->GetMesh();
+		if (Mesh && Mesh->GetSkeletalMeshAsset())
+		{
+			Parent = Mesh;
+			Bone = Mesh->FindClosestBone(Hit.ImpactPoint);
+		}
+	}
+
+	if (!Parent || !Archetypes[ArchetypeIndex].Mesh) return;
+
+	// Make room on this target by evicting its oldest projectile
+	const TObjectKey<AActor> Owner(HitActor);
+	const int32 Cap = Cast<AYomiCharacterBase>(HitActor) ? MaxStuckPerCharacter : MaxStuckPerActor;
+	if (StuckCounts.FindRef(Owner) >= Cap)
+	{
+		int32 Oldest = INDEX_NONE;
+		for (int32 Index = 0; Index < StuckOwners.Num(); ++Index)
+		{
+			if (StuckOwners[Index] == Owner && (Oldest == INDEX_NONE || StuckSerials[Index] < StuckSerials[Oldest]))
+			{
+				Oldest = Index;
+			}
+		}
+		if (Oldest != INDEX_NONE)
+		{
+			RemoveStuckAt(Oldest);
+		}
+	}
+
+	const FTransform ParentTransform = Parent->GetSocketTransform(Bone);
+	const FTransform Stuck(Orientation, Hit.Location);
+
+	StuckArchetypes.Add(static_cast<uint16>(ArchetypeIndex));
+	StuckParents.Add(Parent);
+	StuckBones.Add(Bone);
+	StuckOffsets.Add(Stuck.GetRelativeTransform(ParentTransform));
+	StuckExpiryTimes.Add(GetWorld()->GetTimeSeconds() + StuckLifeSpan);
+	StuckOwners.Add(Owner);
+	StuckSerials.Add(NextStuckSerial++);
+	++StuckCounts.FindOrAdd(Owner);
+}
+
+void UYomiProjectileSubsystem::RemoveStuckAt(int32 Index)
+{
+	if (int32* Count = StuckCounts.Find(StuckOwners[Index]))
+	{
+		if (--(*Count) <= 0)
+		{
+			StuckCounts.Remove(StuckOwners[Index]);
+		}
+	}
+
+	StuckArchetypes.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	StuckParents.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	StuckBones.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	StuckOffsets.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	StuckExpiryTimes.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	StuckOwners.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	StuckSerials.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+void UYomiProjectileSubsystem::ExpireStuckProjectiles()
+{
+	const float Now = GetWorld()->GetTimeSeconds();
+
+	for (int32 Index = StuckParents.Num() - 1; Index >= 0; --Index)
+	{
+		// Pooled actors unregister their components when parked, which takes their arrows with them
+		const USceneComponent* Parent = StuckParents[Index].Get();
+		if (Now >= StuckExpiryTimes[Index] || !Parent || !Parent->IsRegistered())
+		{
+			RemoveStuckAt(Index);
+		}
+	}
+}
+
+// ============================================================================
+// VISUALS
+// ============================================================================
+
+bool UYomiProjectileSubsystem::ShouldRenderVisuals() const
+{
+	return GetWorld() && GetWorld()->GetNetMode() != NM_DedicatedServer;
+}
+
+void UYomiProjectileSubsystem::UpdateVisuals()
+{
+	UWorld* World = GetWorld();
+
+	if (!VisualsActor)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.ObjectFlags |= RF_Transient;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		VisualsActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+		if (!VisualsActor) return;
+
+		USceneComponent* Root = NewObject<USceneComponent>(VisualsActor, TEXT("Root"));
+		VisualsActor->SetRootComponent(Root);
+		Root->RegisterComponent();
+	}
+
+	for (int32 ArchetypeIndex = 0; ArchetypeIndex < Archetypes.Num(); ++ArchetypeIndex)
+	{
+		FYomiProjectileArchetype& Archetype = Archetypes[ArchetypeIndex];
+		if (!Archetype.Mesh) continue;
+
+		InstanceTransforms.Reset();
+		for (int32 Index = 0; Index < Positions.Num(); ++Index)
+		{
+			if (ArchetypeIndices[Index] != ArchetypeIndex) continue;
+
+			const FTransform Flight(Velocities[Index].ToOrientationQuat(), Positions[Index]);
+			InstanceTransforms.Add(Archetype.MeshTransform * Flight);
+		}
+
+		for (int32 Index = 0; Index < StuckParents.Num(); ++Index)
+		{
+			if (StuckArchetypes[Index] != ArchetypeIndex) continue;
+
+			const USceneComponent* Parent = StuckParents[Index].Get();
+			if (!Parent) continue;
+
+			InstanceTransforms.Add(Archetype.MeshTransform * StuckOffsets[Index] * Parent->GetSocketTransform(StuckBones[Index]));
+		}
+
+		if (!Archetype.Instances)
+		{
+			if (InstanceTransforms.Num() == 0) continue;
+
+			UInstancedStaticMeshComponent* Instances = NewObject<UInstancedStaticMeshComponent>(VisualsActor);
+			Instances->SetStaticMesh(Archetype.Mesh);
+			Instances->SetMobility(EComponentMobility::Movable);
+			Instances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+			Instances->SetCanEverAffectNavigation(false);
+			Instances->SetupAttachment(VisualsActor->GetRootComponent());
+			Instances->RegisterComponent();
+			VisualsActor->AddInstanceComponent(Instances);
+			Archetype.Instances = Instances;
+		}
+
+		UInstancedStaticMeshComponent* Instances = Archetype.Instances;
+		const int32 Existing = Instances->GetInstanceCount();
+		const int32 Needed = InstanceTransforms.Num();
+
+		if (Needed == 0)
+		{
+			if (Existing > 0)
+			{
+				Instances->ClearInstances();
+			}
+			continue;
+		}
+
+		if (Existing < Needed)
+		{
+			TArray<FTransform> Added(InstanceTransforms.GetData() + Existing, Needed - Existing);
+			Instances->AddInstances(Added, false, true, false);
+		}
+		else if (Existing > Needed)
+		{
+			TArray<int32> Removed;
+			Removed.Reserve(Existing - Needed);
+			for (int32 InstanceIndex = Needed; InstanceIndex < Existing; ++InstanceIndex)
+			{
+				Removed.Add(InstanceIndex);
+			}
+			Instances->RemoveInstances(Removed);
+		}
+
+		Instances->BatchUpdateInstancesTransforms(0, InstanceTransforms, true, true, true);
+	}
+
+	for (int32 Index = 0; Index < Trails.Num(); ++Index)
+	{
+		if (UNiagaraComponent* Trail = Trails[Index])
+		{
+			Trail->SetWorldLocation(Positions[Index]);
+		}
+	}
+}
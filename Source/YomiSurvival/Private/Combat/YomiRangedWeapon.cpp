@@ -2,32 +2,49 @@
 
 #include "Combat/YomiRangedWeapon.h"
 #include "Combat/YomiProjectile.h"
+#include "Combat/YomiProjectileSubsystem.h"
+#include "Combat/YomiBallistics.h"
+#include "Combat/YomiCombatComponent.h"
+#include "Character/YomiPlayerCharacter.h"
 
 AYomiRangedWeapon::AYomiRangedWeapon()
 {
+	// Ticks only to drive charge visuals; charge and reload are read from timestamps
 	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
+	PrimaryActorTick.TickGroup = TG_PrePhysics;
 	CurrentAmmo = MaxAmmo;
+
+	// Bows do not swing a blade
+	HitDetectionMode = EMeleeHitDetection::Overlap;
 }
 
 void AYomiRangedWeapon::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
-	if (bIsCharging)
-	{
-		CurrentChargeTime = FMath::Min(CurrentChargeTime + DeltaTime, MaxChargeTime);
-	}
+	if (!bIsCharging) return;
 
-	if (ReloadTimer > 0.0f)
+	const float ChargePercent = GetChargePercent();
+	OnChargeChanged.Broadcast(ChargePercent);
+
+	// A full draw holds still; nothing left to animate
+	if (ChargePercent >= 1.0f)
 	{
-		ReloadTimer -= DeltaTime;
+		SetActorTickEnabled(false);
 	}
 }
 
+bool AYomiRangedWeapon::CanStartAttack() const
+{
+	if (bRequiresAmmo && CurrentAmmo <= 0) return false;
+	return !IsReloading() && Super::CanStartAttack();
+}
+
 void AYomiRangedWeapon::StartLightAttack()
 {
 	if (bRequiresAmmo && CurrentAmmo <= 0) return;
-	if (ReloadTimer > 0.0f) return;
+	if (IsReloading()) return;
 
 	if (bCanCharge)
 	{
@@ -62,7 +79,13 @@ void AYomiRangedWeapon::StartSpecialAttack()
 void AYomiRangedWeapon::StartCharging()
 {
 	bIsCharging = true;
-	CurrentChargeTime = 0.0f;
+	ChargeStartTime = GetWorldTime();
+
+	// Dedicated servers and weapons nobody is drawing never need the per-frame update
+	if (OnChargeChanged.IsBound() && GetNetMode() != NM_DedicatedServer)
+	{
+		SetActorTickEnabled(true);
+	}
 }
 
 void AYomiRangedWeapon::ReleaseCharge()
@@ -75,13 +98,50 @@ void AYomiRangedWeapon::ReleaseCharge()
 	FireProjectile(Multiplier);
 
 	bIsCharging = false;
-	CurrentChargeTime = 0.0f;
+	SetActorTickEnabled(false);
+	OnChargeChanged.Broadcast(0.0f);
 }
 
 float AYomiRangedWeapon::GetChargePercent() const
 {
+	if (!bIsCharging) return 0.0f;
 	if (MaxChargeTime <= 0.0f) return 1.0f;
-	return FMath::Clamp(CurrentChargeTime / MaxChargeTime, 0.0f, 1.0f);
+	return FMath::Clamp((GetWorldTime() - ChargeStartTime) / MaxChargeTime, 0.0f, 1.0f);
+}
+
+bool AYomiRangedWeapon::IsReloading() const
+{
+	return GetWorldTime() < ReloadEndTime;
+}
+
+void AYomiRangedWeapon::ApplyAimAssist(const FVector& LaunchLocation, float Speed, FVector& Direction) const
+{
+	if (AimAssistAngle <= 0.0f || !ProjectileClass) return;
+
+	const AYomiPlayerCharacter* Player = Cast<AYomiPlayerCharacter>(GetWeaponOwner());
+	const UYomiCombatComponent* Combat = Player ? Player->GetCombatComponent() : nullptr;
+	const AActor* Target = Combat ? Combat->GetLockedTarget() : nullptr;
+	if (!Target) return;
+
+	// One shot needs one solve; the batched path is for shooters aiming every frame
+	const float GravityZ = GetWorld()->GetGravityZ() * ProjectileClass->GetDefaultObject<AYomiProjectile>()->GetGravityScale();
+	FVector Lead;
+	float TimeOfFlight;
+	if (!YomiBallistics::SolveIntercept(Target->GetActorLocation() - LaunchLocation, Target->GetVelocity(), Speed, GravityZ, Lead, TimeOfFlight))
+	{
+		return;
+	}
+
+	if (FVector::DotProduct(Lead, Direction) >= FMath::Cos(FMath::DegreesToRadians(AimAssistAngle)))
+	{
+		Direction = Lead;
+	}
+}
+
+float AYomiRangedWeapon::GetWorldTime() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0f;
 }
 
 void AYomiRangedWeapon::AddAmmo(int32 Amount)
@@ -99,27 +159,23 @@ void AYomiRangedWeapon::FireProjectile(float ChargeMultiplier)
 
 	if (!GetWeaponOwner()) return;
 
-	FVector SpawnLocation = GetActorLocation() + GetActorForwardVector() * 100.0f;
-	FRotator SpawnRotation = GetWeaponOwner()->GetControlRotation();
+	const FVector LaunchLocation = GetActorLocation() + GetActorForwardVector() * 100.0f;
+	FVector LaunchDirection = GetWeaponOwner()->GetControlRotation().Vector();
 
 	if (ProjectileClass && GetWorld())
 	{
-		FActorSpawnParameters SpawnParams;
-		SpawnParams.Owner = GetWeaponOwner();
-		SpawnParams.Instigator = Cast<APawn>(GetWeaponOwner());
-
-		AYomiProjectile* Projectile = GetWorld()->SpawnActor<AYomiProjectile>(
-			ProjectileClass, SpawnLocation, SpawnRotation, SpawnParams);
+		ApplyAimAssist(LaunchLocation, ProjectileSpeed * ChargeMultiplier, LaunchDirection);
 
-		if (Projectile)
+		if (UYomiProjectileSubsystem* ProjectileSubsystem = GetWorld()->GetSubsystem<UYomiProjectileSubsystem>())
 		{
-			float Damage = CalculateDamage(false, false) * ChargeMultiplier;
-			Projectile->InitializeProjectile(Damage, WeaponData.PrimaryDamageType, ProjectileSpeed * ChargeMultiplier);
+			const float Damage = CalculateDamage(false, false) * ChargeMultiplier;
+			ProjectileSubsystem->LaunchProjectile(ProjectileClass, LaunchLocation, LaunchDirection,
+				ProjectileSpeed * ChargeMultiplier, Damage, WeaponData.PrimaryDamageType, GetWeaponOwner(), WeaponData.OnHitStatus);
 		}
 	}
 
 	ReduceDurability(1);
-	ReloadTimer = ReloadTime;
+	ReloadEndTime = GetWorldTime() + ReloadTime;
 
 	UE_LOG(LogYomiCombat, Verbose, TEXT("Fired projectile with %fx charge multiplier"), ChargeMultiplier);
 }
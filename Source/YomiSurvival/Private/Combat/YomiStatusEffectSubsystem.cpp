@@ -0,0 +1,296 @@
+// Copyright (c) 2026 Yomi Survival. All Rights Reserved.
+
+#include "Combat/YomiStatusEffectSubsystem.h"
+#include "Character/YomiCharacterBase.h"
+#include "Combat/YomiDamageSubsystem.h"
+#include "Core/YomiDataSubsystem.h"
+#include "Engine/GameInstance.h"
+#include "Stats/Stats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Advance Status Effects"), STAT_YomiStatusEffects, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Active Status Effects"), STAT_YomiActiveStatusEffects, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Status Effect Ticks"), STAT_YomiStatusEffectTicks, STATGROUP_Game);
+
+void UYomiStatusEffectSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+	LoadRules();
+}
+
+void UYomiStatusEffectSubsystem::Deinitialize()
+{
+	Targets.Empty();
+	TargetKeys.Empty();
+	Effects.Empty();
+	Magnitudes.Empty();
+	Stacks.Empty();
+	ExpiryTimes.Empty();
+	NextTickTimes.Empty();
+	TickIntervals.Empty();
+	Sources.Empty();
+	EntryIndices.Empty();
+	DirtyTargets.Empty();
+	DueEntries.Empty();
+	Super::Deinitialize();
+}
+
+void UYomiStatusEffectSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Targets.Num() == 0 && DirtyTargets.Num() == 0) return;
+
+	SCOPE_CYCLE_COUNTER(STAT_YomiStatusEffects);
+
+	const float Now = GetWorld()->GetTimeSeconds();
+	ProcessTicks(Now);
+	ProcessExpiry(Now);
+	FlushDirtyTargets();
+
+	SET_DWORD_STAT(STAT_YomiActiveStatusEffects, Targets.Num());
+}
+
+void UYomiStatusEffectSubsystem::LoadRules()
+{
+	const UGameInstance* GameInstance = GetWorld()->GetGameInstance();
+	const UYomiDataSubsystem* Data = GameInstance ? GameInstance->GetSubsystem<UYomiDataSubsystem>() : nullptr;
+	if (!Data) return;
+
+	for (int32 Index = 1; Index < NumEffects; ++Index)
+	{
+		const FStatusEffectData EffectData = Data->GetStatusEffectData(static_cast<EYomiStatusEffect>(Index));
+
+		FEffectRules& EffectRules = Rules[Index];
+		EffectRules.DamageType = EffectData.DamageType;
+		EffectRules.TickInterval = EffectData.TickInterval;
+		EffectRules.Stacking = EffectData.Stacking;
+		EffectRules.MaxStacks = FMath::Clamp(EffectData.MaxStacks, 1, 255);
+		EffectRules.MaxDuration = EffectData.MaxDuration;
+		EffectRules.MaxSpeedReduction = FMath::Clamp(EffectData.MaxSpeedReduction, 0.0f, 0.95f);
+	}
+}
+
+// ============================================================================
+// APPLICATION
+// ============================================================================
+
+bool UYomiStatusEffectSubsystem::ApplyStatusEffect(AYomiCharacterBase* Target, EYomiStatusEffect Effect, float Magnitude, float Duration, AActor* Source)
+{
+	if (!Target || !Target->HasAuthority() || !Target->IsAlive()) return false;
+	if (Effect == EYomiStatusEffect::None || Effect == EYomiStatusEffect::MAX || Magnitude <= 0.0f || Duration <= 0.0f) return false;
+
+	const FEffectRules& EffectRules = Rules[static_cast<int32>(Effect)];
+	const float Now = GetWorld()->GetTimeSeconds();
+	const float CappedDuration = FMath::Min(Duration, EffectRules.MaxDuration);
+
+	const int32 Existing = FindEntry(Target, Effect);
+	if (Existing == INDEX_NONE)
+	{
+		const int32 Index = Targets.Add(Target);
+		TargetKeys.Add(Target);
+		Effects.Add(Effect);
+		Magnitudes.Add(Magnitude);
+		Stacks.Add(1);
+		ExpiryTimes.Add(Now + CappedDuration);
+		TickIntervals.Add(EffectRules.TickInterval);
+		NextTickTimes.Add(EffectRules.TickInterval > 0.0f ? Now + EffectRules.TickInterval : TNumericLimits<float>::Max());
+		Sources.Add(Source);
+
+		EntryIndices.Add(FEntryKey(Target, Effect), Index);
+	}
+	else
+	{
+		switch (EffectRules.Stacking)
+		{
+		case EStatusStacking::Intensity:
+			Stacks[Existing] = static_cast<uint8>(FMath::Min<int32>(Stacks[Existing] + 1, EffectRules.MaxStacks));
+			Magnitudes[Existing] = FMath::Max(Magnitudes[Existing], Magnitude);
+			ExpiryTimes[Existing] = FMath::Max(ExpiryTimes[Existing], Now + CappedDuration);
+			break;
+
+		case EStatusStacking::Duration:
+			ExpiryTimes[Existing] = FMath::Min(ExpiryTimes[Existing] + CappedDuration, Now + EffectRules.MaxDuration);
+			Magnitudes[Existing] = FMath::Max(Magnitudes[Existing], Magnitude);
+			break;
+
+		case EStatusStacking::Refresh:
+		default:
+			// The stronger application wins; a weaker one only renews the timer
+			Magnitudes[Existing] = FMath::Max(Magnitudes[Existing], Magnitude);
+			ExpiryTimes[Existing] = FMath::Max(ExpiryTimes[Existing], Now + CappedDuration);
+			break;
+		}
+
+		Sources[Existing] = Source;
+	}
+
+	MarkDirty(Target);
+	return true;
+}
+
+bool UYomiStatusEffectSubsystem::ApplyInfliction(AYomiCharacterBase* Target, const FYomiStatusInfliction& Infliction, AActor* Source)
+{
+	if (Infliction.Effect == EYomiStatusEffect::None) return false;
+	if (Infliction.Chance < 1.0f && FMath::FRand() >= Infliction.Chance) return false;
+
+	return ApplyStatusEffect(Target, Infliction.Effect, Infliction.Magnitude, Infliction.Duration, Source);
+}
+
+void UYomiStatusEffectSubsystem::RemoveStatusEffect(AYomiCharacterBase* Target, EYomiStatusEffect Effect)
+{
+	const int32 Index = FindEntry(Target, Effect);
+	if (Index != INDEX_NONE)
+	{
+		RemoveEntryAt(Index);
+		MarkDirty(Target);
+	}
+}
+
+void UYomiStatusEffectSubsystem::ClearStatusEffects(AYomiCharacterBase* Target)
+{
+	bool bRemoved = false;
+	for (int32 EffectIndex = 1; EffectIndex < NumEffects; ++EffectIndex)
+	{
+		const int32 Index = FindEntry(Target, static_cast<EYomiStatusEffect>(EffectIndex));
+		if (Index != INDEX_NONE)
+		{
+			RemoveEntryAt(Index);
+			bRemoved = true;
+		}
+	}
+
+	if (bRemoved)
+	{
+		MarkDirty(Target);
+	}
+}
+
+bool UYomiStatusEffectSubsystem::HasStatusEffect(const AYomiCharacterBase* Target, EYomiStatusEffect Effect) const
+{
+	return FindEntry(Target, Effect) != INDEX_NONE;
+}
+
+int32 UYomiStatusEffectSubsystem::FindEntry(const AYomiCharacterBase* Target, EYomiStatusEffect Effect) const
+{
+	const int32* Index = EntryIndices.Find(FEntryKey(Target, Effect));
+	return Index ? *Index : INDEX_NONE;
+}
+
+void UYomiStatusEffectSubsystem::RemoveEntryAt(int32 Index)
+{
+	EntryIndices.Remove(FEntryKey(TargetKeys[Index], Effects[Index]));
+
+	// The last entry is swapped into the hole; repoint its key
+	const int32 LastIndex = Targets.Num() - 1;
+	if (Index != LastIndex)
+	{
+		EntryIndices.Add(FEntryKey(TargetKeys[LastIndex], Effects[LastIndex]), Index);
+	}
+
+	Targets.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	TargetKeys.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Effects.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Magnitudes.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Stacks.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	ExpiryTimes.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	NextTickTimes.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	TickIntervals.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Sources.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+// ============================================================================
+// SIMULATION
+// ============================================================================
+
+void UYomiStatusEffectSubsystem::ProcessTicks(float Now)
+{
+	// Linear scan over the packed tick times; only due entries touch the other arrays
+	DueEntries.Reset();
+	const float* NextTicks = NextTickTimes.GetData();
+	for (int32 Index = 0; Index < NextTickTimes.Num(); ++Index)
+	{
+		if (NextTicks[Index] <= Now)
+		{
+			DueEntries.Add(Index);
+		}
+	}
+
+	if (DueEntries.Num() == 0) return;
+
+	UYomiDamageSubsystem* DamageSubsystem = GetWorld()->GetSubsystem<UYomiDamageSubsystem>();
+
+	int32 NumTicks = 0;
+	for (const int32 Index : DueEntries)
+	{
+		// Never tick past expiry, and catch up on every tick a hitch skipped
+		const float Interval = TickIntervals[Index];
+		const float LastTick = FMath::Min(Now, ExpiryTimes[Index]);
+		const int32 TicksDue = NextTickTimes[Index] <= LastTick ? FMath::FloorToInt((LastTick - NextTickTimes[Index]) / Interval) + 1 : 0;
+		NextTickTimes[Index] += TicksDue * Interval;
+
+		const EDamageType DamageType = Rules[static_cast<int32>(Effects[Index])].DamageType;
+		if (TicksDue == 0 || DamageType == EDamageType::None || !DamageSubsystem) continue;
+
+		const float Damage = Magnitudes[Index] * Stacks[Index] * TicksDue;
+		DamageSubsystem->QueueDamage(Targets[Index].Get(), Damage, DamageType, Sources[Index].Get(), EDamageSource::StatusEffect);
+		NumTicks += TicksDue;
+	}
+
+	SET_DWORD_STAT(STAT_YomiStatusEffectTicks, NumTicks);
+}
+
+void UYomiStatusEffectSubsystem::ProcessExpiry(float Now)
+{
+	for (int32 Index = Targets.Num() - 1; Index >= 0; --Index)
+	{
+		AYomiCharacterBase* Target = Targets[Index].Get();
+		const bool bExpired = ExpiryTimes[Index] <= Now;
+		if (!bExpired && Target && Target->IsAlive()) continue;
+
+		RemoveEntryAt(Index);
+		if (Target)
+		{
+			MarkDirty(Target);
+		}
+	}
+}
+
+void UYomiStatusEffectSubsystem::MarkDirty(AYomiCharacterBase* Target)
+{
+	DirtyTargets.AddUnique(Target);
+}
+
+void UYomiStatusEffectSubsystem::FlushDirtyTargets()
+{
+	TArray<FYomiStatusEffectIcon, TInlineAllocator<NumEffects>> Icons;
+
+	for (const TWeakObjectPtr<AYomiCharacterBase>& WeakTarget : DirtyTargets)
+	{
+		AYomiCharacterBase* Target = WeakTarget.Get();
+		if (!Target) continue;
+
+		Icons.Reset();
+		float SpeedReduction = 0.0f;
+
+		for (int32 EffectIndex = 1; EffectIndex < NumEffects; ++EffectIndex)
+		{
+			const int32 Index = FindEntry(Target, static_cast<EYomiStatusEffect>(EffectIndex));
+			if (Index == INDEX_NONE) continue;
+
+			FYomiStatusEffectIcon& Icon = Icons.AddDefaulted_GetRef();
+			Icon.Effect = Effects[Index];
+			Icon.Stacks = Stacks[Index];
+			Icon.EndTime = ExpiryTimes[Index];
+
+			const float MaxReduction = Rules[EffectIndex].MaxSpeedReduction;
+			if (MaxReduction > 0.0f)
+			{
+				SpeedReduction = FMath::Max(SpeedReduction, FMath::Min(Magnitudes[Index] * Stacks[Index], MaxReduction));
+			}
+		}
+
+		Target->SetStatusEffects(Icons, 1.0f - SpeedReduction);
+	}
+
+	DirtyTargets.Reset();
+}
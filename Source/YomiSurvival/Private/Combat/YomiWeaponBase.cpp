@@ -2,13 +2,25 @@
 
 #include "Combat/YomiWeaponBase.h"
 #include "Character/YomiCharacterBase.h"
+#include "Combat/YomiCombatComponent.h"
+#include "Combat/YomiCombatRules.h"
+#include "Combat/YomiDamageSubsystem.h"
+#include "Combat/YomiLagCompensationSubsystem.h"
+#include "Combat/YomiStatusEffectSubsystem.h"
+#include "Core/YomiDataSubsystem.h"
 #include "Components/BoxComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "NiagaraComponent.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Net/UnrealNetwork.h"
 
 AYomiWeaponBase::AYomiWeaponBase()
 {
-	PrimaryActorTick.bCanEverTick = false;
+	// Ticks only while sweeping a swing, after animation has posed the blade
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
+	PrimaryActorTick.TickGroup = TG_PostUpdateWork;
 	bReplicates = true;
 
 	RootSceneComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
@@ -39,11 +51,27 @@ void AYomiWeaponBase::BeginPlay()
 	DisableDamageCollision();
 }
 
+void AYomiWeaponBase::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (bDamageEnabled && HitDetectionMode == EMeleeHitDetection::SweptTrace)
+	{
+		SweepBlade(DeltaTime);
+	}
+}
+
 void AYomiWeaponBase::InitializeWeapon(const FWeaponData& InData)
 {
 	WeaponData = InData;
+	ReplicatedWeaponType = InData.WeaponType;
 	CurrentDurability = WeaponData.MaxDurability;
 
+	if (!bOverrideSweepAttack)
+	{
+		SweepAttack = YomiCombatRules::DefaultSweepAttack(WeaponData);
+	}
+
 	// Enable spirit effects for Tier 4 weapons
 	if (WeaponData.Tier == EWeaponTier::Spirit && SpiritEffectComponent)
 	{
@@ -51,6 +79,27 @@ void AYomiWeaponBase::InitializeWeapon(const FWeaponData& InData)
 	}
 }
 
+void AYomiWeaponBase::OnRep_WeaponType()
+{
+	if (WeaponData.WeaponType == ReplicatedWeaponType) return;
+
+	const UGameInstance* GameInstance = GetGameInstance();
+	const UYomiDataSubsystem* DataSubsystem = GameInstance ? GameInstance->GetSubsystem<UYomiDataSubsystem>() : nullptr;
+	if (!DataSubsystem) return;
+
+	const FWeaponData Data = DataSubsystem->GetWeaponData(ReplicatedWeaponType);
+	if (Data.WeaponClass != EWeaponClass::None)
+	{
+		InitializeWeapon(Data);
+	}
+}
+
+void AYomiWeaponBase::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+	DOREPLIFETIME(AYomiWeaponBase, ReplicatedWeaponType);
+}
+
 // ============================================================================
 // COMBAT
 // ============================================================================
@@ -58,35 +107,70 @@ void AYomiWeaponBase::InitializeWeapon(const FWeaponData& InData)
 void AYomiWeaponBase::StartLightAttack()
 {
 	if (IsBroken()) return;
-	HitActorsThisSwing.Empty();
+	HitActorsThisSwing.Reset();
+	bAreaSwing = false;
+	bHeavySwing = false;
 	EnableDamageCollision();
 }
 
 void AYomiWeaponBase::StartHeavyAttack()
 {
 	if (IsBroken()) return;
-	HitActorsThisSwing.Empty();
+	HitActorsThisSwing.Reset();
+	bAreaSwing = SweepAttack.Shape != EYomiAreaShape::None;
+	bHeavySwing = true;
 	EnableDamageCollision();
 }
 
 void AYomiWeaponBase::StartSpecialAttack()
 {
 	if (IsBroken()) return;
-	HitActorsThisSwing.Empty();
+	HitActorsThisSwing.Reset();
+	bAreaSwing = SweepAttack.Shape != EYomiAreaShape::None;
+	bHeavySwing = false;
 	EnableDamageCollision();
 }
 
 void AYomiWeaponBase::EnableDamageCollision()
 {
 	bDamageEnabled = true;
-	DamageCollisionBox->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+
+	if (bAreaSwing)
+	{
+		// The whole sweep lands the moment the window opens; the server resolves it for everyone
+		if (HasAuthority())
+		{
+			PerformAreaAttack();
+		}
+		return;
+	}
+
+	if (HitDetectionMode == EMeleeHitDetection::SweptTrace)
+	{
+		// Whoever controls the swing sweeps it; the rest only play the animation
+		if (ShouldSweepLocally())
+		{
+			GetBladeSegment(PreviousBladeBase, PreviousBladeTip);
+			SetActorTickEnabled(true);
+		}
+	}
+	else
+	{
+		DamageCollisionBox->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	}
 }
 
 void AYomiWeaponBase::DisableDamageCollision()
 {
 	bDamageEnabled = false;
+	DamageWindowClosedTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
 	DamageCollisionBox->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-	HitActorsThisSwing.Empty();
+	if (HitDetectionMode == EMeleeHitDetection::SweptTrace)
+	{
+		SetActorTickEnabled(false);
+	}
+
+	// The hit set lives until the next attack starts, so late client reports cannot hit twice
 }
 
 void AYomiWeaponBase::StartBlock()
@@ -104,31 +188,12 @@ void AYomiWeaponBase::EndBlock()
 
 float AYomiWeaponBase::CalculateDamage(bool bIsHeavyAttack, bool bIsStealthAttack) const
 {
-	float Damage = WeaponData.BaseDamage;
-
-	// Heavy attack multiplier
-	if (bIsHeavyAttack)
-	{
-		Damage *= HeavyAttackMultiplier;
-	}
-
-	// Combo multiplier
-	Damage *= (1.0f + CurrentComboCount * ComboMultiplierPerHit);
-
-	// Stealth bonus
-	if (bIsStealthAttack && WeaponData.bHasStealthBonus)
-	{
-		Damage *= WeaponData.StealthDamageMultiplier;
-	}
-
-	// Durability penalty when low
-	float DurabilityPercent = GetDurabilityPercent();
-	if (DurabilityPercent < 0.2f)
-	{
-		Damage *= 0.5f; // Half damage when near broken
-	}
+	// Food, blessings and the like are already folded into the wielder's cached Damage attribute
+	const AYomiCharacterBase* OwnerCharacter = Cast<AYomiCharacterBase>(WeaponOwner);
+	const float DamageScale = OwnerCharacter ? OwnerCharacter->GetAttribute(EYomiAttribute::Damage) : 1.0f;
 
-	return Damage;
+	return YomiCombatRules::WeaponDamage(WeaponData, CurrentComboCount, GetDurabilityPercent(), bIsHeavyAttack, bIsStealthAttack,
+		DamageScale, ComboMultiplierPerHit, HeavyAttackMultiplier);
 }
 
 // ============================================================================
@@ -137,7 +202,7 @@ float AYomiWeaponBase::CalculateDamage(bool bIsHeavyAttack, bool bIsStealthAttac
 
 void AYomiWeaponBase::IncrementCombo()
 {
-	CurrentComboCount = FMath::Min(CurrentComboCount + 1, MaxCombo);
+	CurrentComboCount = YomiCombatRules::NextComboCount(CurrentComboCount, MaxCombo);
 	ComboTimer = ComboWindowDuration;
 }
 
@@ -195,25 +260,176 @@ void AYomiWeaponBase::OnUnequipped()
 
 void AYomiWeaponBase::OnDamageBoxOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
 	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+	ProcessSwingHit(OtherActor, SweepResult);
+}
+
+void AYomiWeaponBase::GetBladeSegment(FVector& OutBase, FVector& OutTip) const
+{
+	if (WeaponMeshComponent->DoesSocketExist(BladeBaseSocket) && WeaponMeshComponent->DoesSocketExist(BladeTipSocket))
+	{
+		OutBase = WeaponMeshComponent->GetSocketLocation(BladeBaseSocket);
+		OutTip = WeaponMeshComponent->GetSocketLocation(BladeTipSocket);
+		return;
+	}
+
+	// Fall back to the long axis of the damage box
+	const FTransform BoxTransform = DamageCollisionBox->GetComponentTransform();
+	const float HalfLength = DamageCollisionBox->GetUnscaledBoxExtent().X;
+	OutBase = BoxTransform.TransformPosition(FVector(-HalfLength, 0.0f, 0.0f));
+	OutTip = BoxTransform.TransformPosition(FVector(HalfLength, 0.0f, 0.0f));
+}
+
+void AYomiWeaponBase::SweepBlade(float DeltaTime)
+{
+	UWorld* World = GetWorld();
+	if (!World || !WeaponOwner) return;
+
+	FVector Base, Tip;
+	GetBladeSegment(Base, Tip);
+
+	// Sub-steps rebuild the blade between the last pose and this one at SweepSubstepRate,
+	// so a fast swing at a low frame rate is still sampled along its arc
+	const int32 NumSteps = FMath::Clamp(FMath::CeilToInt(DeltaTime * SweepSubstepRate), 1, MaxSweepSubsteps);
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(YomiBladeSweep), false, this);
+	Params.AddIgnoredActor(WeaponOwner);
+	const FCollisionObjectQueryParams ObjectParams(ECC_Pawn);
+
+	// The hilt travels in a straight line while the blade turns about it. Lerping the tip
+	// as well would cut inside a curved swing and miss with the part that does the damage.
+	const FVector PrevBlade = PreviousBladeTip - PreviousBladeBase;
+	const FVector CurrBlade = Tip - Base;
+	const float PrevLength = PrevBlade.Size();
+	const float CurrLength = CurrBlade.Size();
+	const bool bCanRotate = PrevLength > KINDA_SMALL_NUMBER && CurrLength > KINDA_SMALL_NUMBER;
+	const FVector PrevDir = bCanRotate ? PrevBlade / PrevLength : FVector::ZeroVector;
+	const FQuat SwingRotation = bCanRotate ? FQuat::FindBetweenNormals(PrevDir, CurrBlade / CurrLength) : FQuat::Identity;
+
+	TArray<FHitResult> Hits;
+	FVector StepBase = PreviousBladeBase;
+	FVector StepTip = PreviousBladeTip;
+
+	for (int32 Step = 1; Step <= NumSteps; ++Step)
+	{
+		const float Alpha = static_cast<float>(Step) / NumSteps;
+		const FVector NextBase = FMath::Lerp(PreviousBladeBase, Base, Alpha);
+		const FVector NextTip = bCanRotate
+			? NextBase + FQuat::Slerp(FQuat::Identity, SwingRotation, Alpha).RotateVector(PrevDir) * FMath::Lerp(PrevLength, CurrLength, Alpha)
+			: FMath::Lerp(PreviousBladeTip, Tip, Alpha);
+
+		const FVector Blade = NextTip - NextBase;
+		const float BladeLength = Blade.Size();
+		if (BladeLength > KINDA_SMALL_NUMBER)
+		{
+			const FCollisionShape Capsule = FCollisionShape::MakeCapsule(BladeSweepRadius, BladeLength * 0.5f + BladeSweepRadius);
+			const FQuat Orientation = FQuat::FindBetweenNormals(FVector::UpVector, Blade / BladeLength);
+
+			Hits.Reset();
+			World->SweepMultiByObjectType(Hits, (StepBase + StepTip) * 0.5f, (NextBase + NextTip) * 0.5f,
+				Orientation, ObjectParams, Capsule, Params);
+
+			for (const FHitResult& Hit : Hits)
+			{
+				ProcessSwingHit(Hit.GetActor(), Hit);
+			}
+		}
+
+		StepBase = NextBase;
+		StepTip = NextTip;
+
+		// A hit can end the swing (e.g. the weapon broke)
+		if (!bDamageEnabled) break;
+	}
+
+	PreviousBladeBase = Base;
+	PreviousBladeTip = Tip;
+}
+
+bool AYomiWeaponBase::ShouldSweepLocally() const
+{
+	// Remote players sweep their own swings and report hits; the server handles everyone else
+	const bool bRemotePlayerOwner = WeaponOwner && WeaponOwner->IsPlayerControlled() && !WeaponOwner->IsLocallyControlled();
+	if (HasAuthority())
+	{
+		return !bRemotePlayerOwner;
+	}
+	return WeaponOwner && WeaponOwner->IsLocallyControlled();
+}
+
+void AYomiWeaponBase::ProcessSwingHit(AActor* OtherActor, const FHitResult& HitResult)
 {
 	if (!bDamageEnabled || !OtherActor || OtherActor == this || OtherActor == WeaponOwner) return;
-	if (HitActorsThisSwing.Contains(OtherActor)) return;
 
-	HitActorsThisSwing.Add(OtherActor);
+	AYomiCharacterBase* HitCharacter = Cast<AYomiCharacterBase>(OtherActor);
+	if (!HasAuthority())
+	{
+		// The owning client saw the hit; the server checks it against where the target was
+		if (!HitCharacter) return;
+
+		bool bAlreadyHit = false;
+		HitActorsThisSwing.Add(OtherActor, &bAlreadyHit);
+		if (bAlreadyHit) return;
+
+		UYomiCombatComponent* CombatComponent = WeaponOwner ? WeaponOwner->FindComponentByClass<UYomiCombatComponent>() : nullptr;
+		if (CombatComponent)
+		{
+			FVector Base, Tip;
+			GetBladeSegment(Base, Tip);
+			CombatComponent->ReportMeleeHit(HitCharacter, Base, Tip, GetLastHitPart(), UYomiLagCompensationSubsystem::GetViewTimestamp(WeaponOwner));
+		}
+		return;
+	}
+
+	bool bAlreadyHit = false;
+	HitActorsThisSwing.Add(OtherActor, &bAlreadyHit);
+	if (bAlreadyHit) return;
+
+	ApplySwingHit(OtherActor, HitResult);
+}
+
+void AYomiWeaponBase::ProcessReportedHit(AYomiCharacterBase* Target, const FHitResult& HitResult)
+{
+	if (!HasAuthority() || !Target || Target == WeaponOwner) return;
+
+	// Reports trail the swing by the client's latency, so accept them a little after the window closes
+	const bool bInWindow = bDamageEnabled || GetWorld()->GetTimeSeconds() - DamageWindowClosedTime <= ReportedHitGraceTime;
+	if (!bInWindow) return;
+
+	bool bAlreadyHit = false;
+	HitActorsThisSwing.Add(Target, &bAlreadyHit);
+	if (bAlreadyHit) return;
+
+	ApplySwingHit(Target, HitResult);
+}
 
+void AYomiWeaponBase::ApplySwingHit(AActor* OtherActor, const FHitResult& HitResult)
+{
 	AYomiCharacterBase* HitCharacter = Cast<AYomiCharacterBase>(OtherActor);
-	if (HitCharacter)
+	UYomiDamageSubsystem* DamageSubsystem = GetWorld()->GetSubsystem<UYomiDamageSubsystem>();
+	if (HitCharacter && DamageSubsystem)
 	{
+		// Primary and secondary damage are resolved together with every other hit this frame
 		float Damage = CalculateDamage(false, false);
-		float DamageDealt = HitCharacter->ApplyDamage(Damage, WeaponData.PrimaryDamageType, WeaponOwner);
+		DamageSubsystem->QueueDamage(HitCharacter, Damage, WeaponData.PrimaryDamageType, WeaponOwner, EDamageSource::Melee);
 
-		// Apply secondary damage if exists
 		if (WeaponData.SecondaryDamageType != EDamageType::None && WeaponData.SecondaryDamageAmount > 0.0f)
 		{
-			HitCharacter->ApplyDamage(WeaponData.SecondaryDamageAmount, WeaponData.SecondaryDamageType, WeaponOwner);
+			DamageSubsystem->QueueDamage(HitCharacter, WeaponData.SecondaryDamageAmount, WeaponData.SecondaryDamageType, WeaponOwner, EDamageSource::Melee);
+		}
+
+		if (WeaponData.OnHitStatus.Effect != EYomiStatusEffect::None)
+		{
+			if (UYomiStatusEffectSubsystem* StatusEffects = GetWorld()->GetSubsystem<UYomiStatusEffectSubsystem>())
+			{
+				StatusEffects->ApplyInfliction(HitCharacter, WeaponData.OnHitStatus, WeaponOwner);
+			}
 		}
 
-		OnWeaponHit.Broadcast(OtherActor, DamageDealt, SweepResult);
+		// Expected primary damage after resistance; the final value is applied at the end of the frame
+		const float DamageDealt = Damage * (1.0f - HitCharacter->GetDamageResistance(WeaponData.PrimaryDamageType));
+
+		OnWeaponHit.Broadcast(OtherActor, DamageDealt, HitResult);
 		ReduceDurability(1);
 		IncrementCombo();
 
@@ -221,3 +437,50 @@ void AYomiWeaponBase::OnDamageBoxOverlap(UPrimitiveComponent* OverlappedComponen
 			*OtherActor->GetName(), DamageDealt, CurrentComboCount);
 	}
 }
+
+void AYomiWeaponBase::PerformAreaAttack()
+{
+	AYomiCharacterBase* OwnerCharacter = Cast<AYomiCharacterBase>(WeaponOwner);
+	UYomiDamageSubsystem* DamageSubsystem = GetWorld()->GetSubsystem<UYomiDamageSubsystem>();
+	if (!OwnerCharacter || !DamageSubsystem) return;
+
+	// One registry query and one queued batch, however many foes are caught in the sweep
+	AreaTargets.Reset();
+	const float Damage = CalculateDamage(bHeavySwing, false);
+	const int32 NumTargets = DamageSubsystem->QueueAreaAttack(SweepAttack, OwnerCharacter->GetActorLocation(), OwnerCharacter->GetActorForwardVector(),
+		Damage, WeaponData.PrimaryDamageType, OwnerCharacter, OwnerCharacter, EDamageSource::AreaOfEffect, &AreaTargets);
+	if (NumTargets == 0) return;
+
+	const bool bHasSecondary = WeaponData.SecondaryDamageType != EDamageType::None && WeaponData.SecondaryDamageAmount > 0.0f;
+	const FVector Origin = OwnerCharacter->GetActorLocation();
+	UYomiStatusEffectSubsystem* StatusEffects = WeaponData.OnHitStatus.Effect != EYomiStatusEffect::None
+		? GetWorld()->GetSubsystem<UYomiStatusEffectSubsystem>() : nullptr;
+
+	for (AYomiCharacterBase* Target : AreaTargets)
+	{
+		HitActorsThisSwing.Add(Target);
+
+		if (bHasSecondary)
+		{
+			DamageSubsystem->QueueDamage(Target, WeaponData.SecondaryDamageAmount * SweepAttack.DamageScale, WeaponData.SecondaryDamageType,
+				OwnerCharacter, EDamageSource::AreaOfEffect);
+		}
+
+		if (StatusEffects)
+		{
+			StatusEffects->ApplyInfliction(Target, WeaponData.OnHitStatus, OwnerCharacter);
+		}
+
+		const FVector TargetLocation = Target->GetActorLocation();
+		const FHitResult HitResult(Target, nullptr, TargetLocation, (Origin - TargetLocation).GetSafeNormal());
+		const float DamageDealt = Damage * SweepAttack.DamageScale * (1.0f - Target->GetDamageResistance(WeaponData.PrimaryDamageType));
+		OnWeaponHit.Broadcast(Target, DamageDealt, HitResult);
+	}
+
+	// A sweep wears the weapon and builds the combo once, not once per foe
+	ReduceDurability(1);
+	IncrementCombo();
+
+	UE_LOG(LogYomiCombat, Verbose, TEXT("%s sweep hit %d targets (Combo: %d)"),
+		*WeaponData.DisplayName.ToString(), NumTargets, CurrentComboCount);
+}
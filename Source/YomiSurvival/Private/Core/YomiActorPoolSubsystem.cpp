@@ -0,0 +1,304 @@
+// Copyright (c) 2026 Yomi Survival. All Rights Reserved.
+
+#include "Core/YomiActorPoolSubsystem.h"
+#include "Core/YomiGameTypes.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "TimerManager.h"
+#include "Stats/Stats.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pooled Actors In Use"), STAT_YomiPooledInUse, STATGROUP_Game);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pooled Actors Parked"), STAT_YomiPooledParked, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pool Misses"), STAT_YomiPoolMisses, STATGROUP_Game);
+
+void UYomiActorPoolSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		for (TPair<TObjectKey<AActor>, FTimerHandle>& Pair : PendingReleases)
+		{
+			World->GetTimerManager().ClearTimer(Pair.Value);
+		}
+	}
+
+	// Parked actors belong to the level and go away with it
+	PendingReleases.Empty();
+	Pools.Empty();
+	InUseActors.Empty();
+	ParkedActors.Empty();
+	Super::Deinitialize();
+}
+
+// ============================================================================
+// ACQUIRE / RELEASE
+// ============================================================================
+
+void UYomiActorPoolSubsystem::Prewarm(TSubclassOf<AActor> Class, int32 Count)
+{
+	if (!Class || !GetWorld()) return;
+
+	FPool& Pool = Pools.FindOrAdd(Class.Get());
+	const int32 Target = FMath::Min(Count, MaxFreeActorsPerClass);
+
+	while (Pool.Free.Num() < Target)
+	{
+		AActor* Actor = SpawnPooledActor(Class, FTransform::Identity, nullptr, nullptr, [](AActor*) {});
+		if (!Actor) break;
+
+		if (IYomiPoolable* Poolable = Cast<IYomiPoolable>(Actor))
+		{
+			Poolable->OnReturnedToPool();
+		}
+		ParkActor(Actor);
+		Pool.Free.Add(Actor);
+	}
+
+	UE_LOG(LogYomi, Log, TEXT("Pre-warmed %d %s actors"), Pool.Free.Num(), *Class->GetName());
+}
+
+AActor* UYomiActorPoolSubsystem::AcquireActor(TSubclassOf<AActor> Class, const FTransform& Transform, AActor* Owner, APawn* Instigator,
+	TFunctionRef<void(AActor*)> Configure, ESpawnActorCollisionHandlingMethod CollisionHandling)
+{
+	if (!Class || !GetWorld()) return nullptr;
+
+	FPool& Pool = Pools.FindOrAdd(Class.Get());
+
+	AActor* Actor = nullptr;
+	while (!Actor && Pool.Free.Num() > 0)
+	{
+		// Parked actors can still be destroyed underneath us, e.g. by level streaming
+		Actor = Pool.Free.Pop(EAllowShrinking::No).Get();
+		if (Actor && !IsValid(Actor))
+		{
+			Actor = nullptr;
+		}
+	}
+
+	if (Actor)
+	{
+		ParkedActors.Remove(Actor);
+		DEC_DWORD_STAT(STAT_YomiPooledParked);
+		ActivateActor(Actor, Transform, Owner, Instigator, Configure, CollisionHandling);
+	}
+	else
+	{
+		Actor = SpawnPooledActor(Class, Transform, Owner, Instigator, Configure, CollisionHandling);
+		if (!Actor) return nullptr;
+
+		++Pool.Stats.NumMisses;
+		INC_DWORD_STAT(STAT_YomiPoolMisses);
+	}
+
+	InUseActors.Add(Actor);
+	++Pool.Stats.NumInUse;
+	++Pool.Stats.NumAcquired;
+	INC_DWORD_STAT(STAT_YomiPooledInUse);
+
+	if (IYomiPoolable* Poolable = Cast<IYomiPoolable>(Actor))
+	{
+		Poolable->OnAcquiredFromPool();
+	}
+
+	return Actor;
+}
+
+void UYomiActorPoolSubsystem::ReleaseActor(AActor* Actor)
+{
+	if (!IsValid(Actor) || Actor->GetWorld() != GetWorld()) return;
+
+	CancelPendingRelease(Actor);
+	if (ParkedActors.Contains(Actor)) return;
+
+	FPool& Pool = Pools.FindOrAdd(Actor->GetClass());
+	if (InUseActors.Remove(Actor) > 0)
+	{
+		--Pool.Stats.NumInUse;
+		DEC_DWORD_STAT(STAT_YomiPooledInUse);
+	}
+
+	if (Pool.Free.Num() >= MaxFreeActorsPerClass)
+	{
+		++Pool.Stats.NumDestroyed;
+		Actor->Destroy();
+		return;
+	}
+
+	if (IYomiPoolable* Poolable = Cast<IYomiPoolable>(Actor))
+	{
+		Poolable->OnReturnedToPool();
+	}
+	OnActorReleased.Broadcast(Actor);
+
+	ParkActor(Actor);
+	Pool.Free.Add(Actor);
+	++Pool.Stats.NumReleased;
+}
+
+void UYomiActorPoolSubsystem::ReleaseActorAfter(AActor* Actor, float Delay)
+{
+	if (!IsValid(Actor) || !GetWorld()) return;
+
+	if (Delay <= 0.0f)
+	{
+		ReleaseActor(Actor);
+		return;
+	}
+
+	CancelPendingRelease(Actor);
+
+	const TWeakObjectPtr<AActor> WeakActor = Actor;
+	const TObjectKey<AActor> Key = Actor;
+	FTimerHandle& Handle = PendingReleases.Add(Key);
+	GetWorld()->GetTimerManager().SetTimer(Handle, FTimerDelegate::CreateWeakLambda(this, [this, WeakActor, Key]()
+	{
+		PendingReleases.Remove(Key);
+		ReleaseActor(WeakActor.Get());
+	}), Delay, false);
+}
+
+void UYomiActorPoolSubsystem::CancelPendingRelease(const AActor* Actor)
+{
+	FTimerHandle Handle;
+	if (PendingReleases.RemoveAndCopyValue(Actor, Handle) && GetWorld())
+	{
+		GetWorld()->GetTimerManager().ClearTimer(Handle);
+	}
+}
+
+void UYomiActorPoolSubsystem::TrimPool(TSubclassOf<AActor> Class, int32 MaxFree)
+{
+	FPool* Pool = Pools.Find(Class.Get());
+	if (!Pool) return;
+
+	while (Pool->Free.Num() > FMath::Max(MaxFree, 0))
+	{
+		if (AActor* Actor = Pool->Free.Pop(EAllowShrinking::No).Get())
+		{
+			ParkedActors.Remove(Actor);
+			DEC_DWORD_STAT(STAT_YomiPooledParked);
+			++Pool->Stats.NumDestroyed;
+			Actor->Destroy();
+		}
+	}
+}
+
+// ============================================================================
+// PARKING
+// ============================================================================
+
+AActor* UYomiActorPoolSubsystem::SpawnPooledActor(UClass* Class, const FTransform& Transform, AActor* Owner, APawn* Instigator,
+	TFunctionRef<void(AActor*)> Configure, ESpawnActorCollisionHandlingMethod CollisionHandling)
+{
+	AActor* Actor = GetWorld()->SpawnActorDeferred<AActor>(Class, Transform, Owner, Instigator, CollisionHandling);
+	if (!Actor) return nullptr;
+
+	Configure(Actor);
+	Actor->FinishSpawning(Transform);
+
+	++Pools.FindOrAdd(Class).Stats.NumSpawned;
+	return Actor;
+}
+
+void UYomiActorPoolSubsystem::ParkActor(AActor* Actor)
+{
+	Actor->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+
+	// Attack, parry and other component windows must not fire on a parked actor
+	FTimerManager& TimerManager = Actor->GetWorldTimerManager();
+	TimerManager.ClearAllTimersForObject(Actor);
+	if (const APawn* Pawn = Cast<APawn>(Actor))
+	{
+		TimerManager.ClearAllTimersForObject(Pawn->GetController());
+	}
+
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+	Actor->SetActorTickEnabled(false);
+	Actor->ForEachComponent(false, [&TimerManager](UActorComponent* Component)
+	{
+		TimerManager.ClearAllTimersForObject(Component);
+		Component->SetComponentTickEnabled(false);
+	});
+
+	// No render, physics or navigation state while parked
+	Actor->UnregisterAllComponents();
+
+	// Let clients see it hide, then stop considering it for replication
+	if (Actor->GetIsReplicated() && Actor->HasAuthority())
+	{
+		Actor->ForceNetUpdate();
+		Actor->SetNetDormancy(DORM_DormantAll);
+	}
+
+	ParkedActors.Add(Actor);
+	INC_DWORD_STAT(STAT_YomiPooledParked);
+}
+
+void UYomiActorPoolSubsystem::ActivateActor(AActor* Actor, const FTransform& Transform, AActor* Owner, APawn* Instigator,
+	TFunctionRef<void(AActor*)> Configure, ESpawnActorCollisionHandlingMethod CollisionHandling)
+{
+	Actor->SetOwner(Owner);
+	Actor->SetInstigator(Instigator);
+	Actor->SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+	Actor->SetActorHiddenInGame(false);
+	Actor->SetActorEnableCollision(true);
+
+	Configure(Actor);
+
+	Actor->RegisterAllComponents();
+
+	// Nudge out of blocking geometry as SpawnActor would for a fresh actor
+	if (CollisionHandling == ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn
+		|| CollisionHandling == ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButDontSpawnIfColliding)
+	{
+		FVector Location = Transform.GetLocation();
+		FRotator Rotation = Transform.Rotator();
+		if (GetWorld()->EncroachingBlockingGeometry(Actor, Location, Rotation) && GetWorld()->FindTeleportSpot(Actor, Location, Rotation))
+		{
+			Actor->SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::ResetPhysics);
+		}
+	}
+
+	Actor->SetActorTickEnabled(Actor->PrimaryActorTick.bStartWithTickEnabled);
+	Actor->ForEachComponent(false, [](UActorComponent* Component)
+	{
+		Component->SetComponentTickEnabled(Component->PrimaryComponentTick.bStartWithTickEnabled);
+	});
+
+	if (Actor->GetIsReplicated() && Actor->HasAuthority())
+	{
+		Actor->SetNetDormancy(Actor->GetClass()->GetDefaultObject<AActor>()->NetDormancy);
+		Actor->FlushNetDormancy();
+	}
+}
+
+// ============================================================================
+// STATISTICS
+// ============================================================================
+
+FYomiActorPoolStats UYomiActorPoolSubsystem::GetPoolStats(TSubclassOf<AActor> Class) const
+{
+	const FPool* Pool = Pools.Find(Class.Get());
+	if (!Pool) return FYomiActorPoolStats();
+
+	FYomiActorPoolStats Stats = Pool->Stats;
+	Stats.NumFree = Pool->Free.Num();
+	return Stats;
+}
+
+FYomiActorPoolStats UYomiActorPoolSubsystem::GetTotalStats() const
+{
+	FYomiActorPoolStats Total;
+	for (const TPair<TObjectKey<UClass>, FPool>& Pair : Pools)
+	{
+		const FYomiActorPoolStats& Stats = Pair.Value.Stats;
+		Total.NumFree += Pair.Value.Free.Num();
+		Total.NumInUse += Stats.NumInUse;
+		Total.NumSpawned += Stats.NumSpawned;
+		Total.NumAcquired += Stats.NumAcquired;
+		Total.NumReleased += Stats.NumReleased;
+		Total.NumMisses += Stats.NumMisses;
+		Total.NumDestroyed += Stats.NumDestroyed;
+	}
+	return Total;
+}
@@ -5,14 +5,25 @@
 void UYomiDataSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
+	LoadDefaultData();
+}
+
+void UYomiDataSubsystem::LoadDefaultData()
+{
+	WeaponDatabase.Reset();
+	ArmorDatabase.Reset();
+	FoodDatabase.Reset();
+	BiomeDatabase.Reset();
+	StatusEffectDatabase.Reset();
 
 	InitializeWeaponData();
 	InitializeArmorData();
 	InitializeFoodData();
 	InitializeBiomeData();
+	InitializeStatusEffectData();
 
-	UE_LOG(LogYomi, Log, TEXT("YomiDataSubsystem initialized: %d weapons, %d armor, %d foods, %d biomes"),
-		WeaponDatabase.Num(), ArmorDatabase.Num(), FoodDatabase.Num(), BiomeDatabase.Num());
+	UE_LOG(LogYomi, Log, TEXT("YomiDataSubsystem initialized: %d weapons, %d armor, %d foods, %d biomes, %d status effects"),
+		WeaponDatabase.Num(), ArmorDatabase.Num(), FoodDatabase.Num(), BiomeDatabase.Num(), StatusEffectDatabase.Num());
 }
 
 // ============================================================================
@@ -148,6 +159,10 @@ void UYomiDataSubsystem::InitializeWeaponData()
 		60.0f, 1.4f, 180.0f, 10.0f, 0.0f, EDamageType::Physical, true, 0.4f, false, 1.0f, 300);
 	WeaponDatabase[EWeaponType::Muramasa].SecondaryDamageType = EDamageType::Curse;
 	WeaponDatabase[EWeaponType::Muramasa].SecondaryDamageAmount = 5.0f; // Self-damage
+	WeaponDatabase[EWeaponType::Muramasa].OnHitStatus.Effect = EYomiStatusEffect::Curse;
+	WeaponDatabase[EWeaponType::Muramasa].OnHitStatus.Magnitude = 4.0f;
+	WeaponDatabase[EWeaponType::Muramasa].OnHitStatus.Duration = 10.0f;
+	WeaponDatabase[EWeaponType::Muramasa].OnHitStatus.Chance = 0.25f;
 
 	AddWeapon(EWeaponType::KusanagiNoTsurugi,
 		TEXT("Kusanagi-no-Tsurugi"), TEXT("The Grass-Cutting Sword of legend. Its spirit energy slashes cut through the air itself."),
@@ -183,6 +198,9 @@ void UYomiDataSubsystem::InitializeWeaponData()
 		TEXT("Fukiya"), TEXT("A blowgun with poison darts. Silent and lethal from the shadows."),
 		EWeaponTier::Iron, EWeaponClass::Blowgun,
 		5.0f, 1.5f, 1800.0f, 4.0f, 0.0f, EDamageType::Poison, false, 0.0f, true, 2.0f, 80);
+	WeaponDatabase[EWeaponType::Fukiya].OnHitStatus.Effect = EYomiStatusEffect::Poison;
+	WeaponDatabase[EWeaponType::Fukiya].OnHitStatus.Magnitude = 3.0f;
+	WeaponDatabase[EWeaponType::Fukiya].OnHitStatus.Duration = 8.0f;
 
 	AddWeapon(EWeaponType::Teppo,
 		TEXT("Teppō"), TEXT("A matchlock gun. Rare and devastating, but slow and expensive."),
@@ -214,6 +232,9 @@ void UYomiDataSubsystem::InitializeWeaponData()
 		TEXT("Caltrops"), TEXT("Scattered metal spikes for area denial. Slows and damages pursuers."),
 		EWeaponTier::Iron, EWeaponClass::Utility,
 		5.0f, 1.0f, 300.0f, 3.0f, 0.0f, EDamageType::Physical, false, 0.0f, false, 1.0f, 1);
+	WeaponDatabase[EWeaponType::Caltrops].OnHitStatus.Effect = EYomiStatusEffect::Slow;
+	WeaponDatabase[EWeaponType::Caltrops].OnHitStatus.Magnitude = 0.4f;
+	WeaponDatabase[EWeaponType::Caltrops].OnHitStatus.Duration = 4.0f;
 }
 
 // ============================================================================
@@ -423,6 +444,39 @@ void UYomiDataSubsystem::InitializeBiomeData()
 		20.0f, FLinearColor(1.0f, 0.95f, 0.8f, 1.0f), FLinearColor(0.9f, 0.85f, 0.7f, 1.0f), 0.01f);
 }
 
+// ============================================================================
+// STATUS EFFECT DATA
+// ============================================================================
+
+void UYomiDataSubsystem::InitializeStatusEffectData()
+{
+	auto AddStatusEffect = [this](EYomiStatusEffect Effect, const FString& Name, EDamageType DmgType,
+		float TickInterval, EStatusStacking Stacking, int32 MaxStacks, float MaxDuration, float MaxSpeedReduction = 0.0f)
+	{
+		FStatusEffectData Data;
+		Data.Effect = Effect;
+		Data.DisplayName = FText::FromString(Name);
+		Data.DamageType = DmgType;
+		Data.TickInterval = TickInterval;
+		Data.Stacking = Stacking;
+		Data.MaxStacks = MaxStacks;
+		Data.MaxDuration = MaxDuration;
+		Data.MaxSpeedReduction = MaxSpeedReduction;
+		StatusEffectDatabase.Add(Effect, Data);
+	};
+
+	// Each dart adds a dose; doses wear off together
+	AddStatusEffect(EYomiStatusEffect::Poison, TEXT("Poisoned"), EDamageType::Poison, 1.0f, EStatusStacking::Intensity, 5, 12.0f);
+
+	// Fast ticks, the hottest flame wins
+	AddStatusEffect(EYomiStatusEffect::Burn, TEXT("Burning"), EDamageType::Fire, 0.5f, EStatusStacking::Refresh, 1, 6.0f);
+
+	// Slow and long; every new cut lengthens it
+	AddStatusEffect(EYomiStatusEffect::Curse, TEXT("Cursed"), EDamageType::Curse, 2.0f, EStatusStacking::Duration, 1, 30.0f);
+
+	AddStatusEffect(EYomiStatusEffect::Slow, TEXT("Slowed"), EDamageType::None, 0.0f, EStatusStacking::Refresh, 1, 8.0f, 0.6f);
+}
+
 // ============================================================================
 // DATA ACCESS
 // ============================================================================
@@ -511,3 +565,12 @@ FBiomeData UYomiDataSubsystem::GetBiomeData(EYomiBiome Biome) const
 	}
 	return FBiomeData();
 }
+
+FStatusEffectData UYomiDataSubsystem::GetStatusEffectData(EYomiStatusEffect Effect) const
+{
+	if (const FStatusEffectData* Data = StatusEffectDatabase.Find(Effect))
+	{
+		return *Data;
+	}
+	return FStatusEffectData();
+}
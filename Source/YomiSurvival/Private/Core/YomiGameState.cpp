@@ -53,9 +53,25 @@ void AYomiGameState::AdvanceDay()
 	UE_LOG(LogYomi, Log, TEXT("Day %d in Meido"), WorldDay);
 }
 
+void AYomiGameState::MulticastBuildingHealthBatch_Implementation(const TArray<FYomiBuildingHealthUpdate>& Updates)
+{
+	if (UYomiBuildingSubsystem* BuildingSubsystem = GetWorld()->GetSubsystem<UYomiBuildingSubsystem>())
+	{
+		BuildingSubsystem->HandleHealthBatch(Updates);
+	}
+}
+
 void AYomiGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 	DOREPLIFETIME(AYomiGameState, DefeatedBosses);
 	DOREPLIFETIME(AYomiGameState, WorldDay);
 }
+
+void AYomiGameState::MulticastProjectilesFired_Implementation(const TArray<FYomiProjectileLaunch>& Launches)
+{
+	if (UYomiProjectileSubsystem* ProjectileSubsystem = GetWorld()->GetSubsystem<UYomiProjectileSubsystem>())
+	{
+		ProjectileSubsystem->HandleLaunchBatch(Launches);
+	}
+}
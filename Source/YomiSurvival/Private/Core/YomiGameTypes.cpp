@@ -8,3 +8,40 @@ DEFINE_LOG_CATEGORY(LogYomiCrafting);
 DEFINE_LOG_CATEGORY(LogYomiWorld);
 DEFINE_LOG_CATEGORY(LogYomiAI);
 DEFINE_LOG_CATEGORY(LogYomiBuilding);
+
+bool FYomiRegenStat::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	// Packed, so a stat at rest with no delay costs a few bytes besides the anchor time.
+	// Never rounded down to zero, so a barely living character does not arrive dead.
+	uint32 PackedValue = FMath::RoundToInt(FMath::Max(0.0f, Value) * 10.0f);
+	if (PackedValue == 0 && Value > 0.0f)
+	{
+		PackedValue = 1;
+	}
+	uint32 PackedDelay = FMath::RoundToInt(FMath::Max(0.0f, RegenStartTime - AnchorTime) * 100.0f);
+
+	// The owner extrapolates with Rate for as long as the anchor stands, so it is sent exactly
+	uint8 bHasRate = Rate != 0.0f;
+
+	Ar.SerializeIntPacked(PackedValue);
+	Ar << AnchorTime;
+	Ar.SerializeBits(&bHasRate, 1);
+	if (bHasRate)
+	{
+		Ar << Rate;
+	}
+	Ar.SerializeIntPacked(PackedDelay);
+
+	if (Ar.IsLoading())
+	{
+		Value = PackedValue / 10.0f;
+		if (!bHasRate)
+		{
+			Rate = 0.0f;
+		}
+		RegenStartTime = AnchorTime + PackedDelay / 100.0f;
+	}
+
+	bOutSuccess = true;
+	return true;
+}
@@ -1,6 +1,10 @@
 // Copyright (c) 2026 Yomi Survival. All Rights Reserved.
 
 #include "Inventory/YomiInventoryComponent.h"
+#include "Character/YomiCharacterBase.h"
+#include "Core/YomiDataSubsystem.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
 
 UYomiInventoryComponent::UYomiInventoryComponent()
 {
@@ -223,6 +227,7 @@ bool UYomiInventoryComponent::EquipArmor(int32 InventorySlotIndex, EArmorSlot Ar
 		InventorySlots[InventorySlotIndex].Clear();
 	}
 
+	RefreshArmorModifiers();
 	OnEquipmentChanged.Broadcast(ArmorSlot, EquipmentSlots[ArmorSlot].ItemID);
 	OnInventoryChanged.Broadcast();
 	return true;
@@ -239,6 +244,7 @@ bool UYomiInventoryComponent::UnequipArmor(EArmorSlot ArmorSlot)
 	if (Added > 0)
 	{
 		EquipmentSlots[ArmorSlot].Clear();
+		RefreshArmorModifiers();
 		OnEquipmentChanged.Broadcast(ArmorSlot, NAME_None);
 		return true;
 	}
@@ -256,12 +262,32 @@ FYomiInventorySlot UYomiInventoryComponent::GetEquippedArmor(EArmorSlot Slot) co
 	return FYomiInventorySlot();
 }
 
-float UYomiInventoryComponent::GetTotalArmorDefense() const
+void UYomiInventoryComponent::RefreshArmorModifiers()
 {
-	float Total = 0.0f;
-	// In full implementation, this would look up armor data from data tables
-	// For each equipped armor piece, add its defense value
-	return Total;
+	const UGameInstance* GameInstance = GetWorld() ? GetWorld()->GetGameInstance() : nullptr;
+	const UYomiDataSubsystem* Data = GameInstance ? GameInstance->GetSubsystem<UYomiDataSubsystem>() : nullptr;
+	if (!Data) return;
+
+	// Looked up once per equipment change; combat only ever reads the owner's cached attributes
+	FYomiModifierLayer Layer;
+	TotalArmorDefense = 0.0f;
+
+	for (const TPair<EArmorSlot, FYomiInventorySlot>& Pair : EquipmentSlots)
+	{
+		if (Pair.Value.IsEmpty()) continue;
+
+		const FArmorData Armor = Data->GetArmorDataByID(Pair.Value.ItemID);
+		Layer.Add(EYomiAttribute::PhysicalDefense, Armor.PhysicalDefense);
+		Layer.Add(EYomiAttribute::SpiritDefense, Armor.SpiritDefense);
+		Layer.Add(EYomiAttribute::MoveSpeed, 0.0f, Armor.MovementSpeedModifier);
+		Layer.Add(EYomiAttribute::StaminaRegen, 0.0f, Armor.StaminaRegenModifier);
+		TotalArmorDefense += Armor.PhysicalDefense + Armor.SpiritDefense;
+	}
+
+	if (AYomiCharacterBase* OwnerCharacter = Cast<AYomiCharacterBase>(GetOwner()))
+	{
+		OwnerCharacter->SetModifierLayer(EYomiModifierSource::Armor, Layer);
+	}
 }
 
 // ============================================================================
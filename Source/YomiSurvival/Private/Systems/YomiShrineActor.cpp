@@ -2,6 +2,7 @@
 
 #include "Systems/YomiShrineActor.h"
 #include "Character/YomiPlayerCharacter.h"
+#include "Combat/YomiCombatRules.h"
 #include "Components/SphereComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "NiagaraComponent.h"
@@ -47,24 +48,38 @@ void AYomiShrineActor::Discover()
 	// Notify UI, play discovery VFX/sound
 }
 
-bool AYomiShrineActor::MakeOffering(FName ItemID, int32 Quantity)
+bool AYomiShrineActor::MakeOffering(FName ItemID, int32 Quantity, AYomiPlayerCharacter* Offerer)
 {
 	// Calculate offering value based on item rarity/type
 	int32 Value = Quantity * 10; // Simplified
 	TotalOfferingValue += Value;
 
 	// Grant blessing based on total offerings
+	FYomiModifierLayer Blessing;
+	float BlessingDuration = 0.0f;
 	if (TotalOfferingValue >= 100)
 	{
 		CurrentBlessing = FText::FromString(TEXT("Blessing of the Kami - +20% damage for 10 minutes"));
+		Blessing.Add(EYomiAttribute::Damage, 0.0f, 0.2f);
+		BlessingDuration = 600.0f;
 	}
 	else if (TotalOfferingValue >= 50)
 	{
 		CurrentBlessing = FText::FromString(TEXT("Favor of the Kami - +10% defense for 10 minutes"));
+		Blessing.Add(EYomiAttribute::PhysicalDefense, YomiCombatRules::DefenseBonusToDefense(0.1f));
+		Blessing.Add(EYomiAttribute::SpiritDefense, YomiCombatRules::DefenseBonusToDefense(0.1f));
+		BlessingDuration = 600.0f;
 	}
 	else if (TotalOfferingValue >= 10)
 	{
 		CurrentBlessing = FText::FromString(TEXT("Notice of the Kami - Enhanced Ki regen for 5 minutes"));
+		Blessing.Add(EYomiAttribute::KiRegen, 0.0f, 0.5f);
+		BlessingDuration = 300.0f;
+	}
+
+	if (Offerer && BlessingDuration > 0.0f)
+	{
+		Offerer->ReceiveBlessing(Blessing, BlessingDuration);
 	}
 
 	UE_LOG(LogYomi, Log, TEXT("Offering made at %s: %s x%d (Total value: %d)"),
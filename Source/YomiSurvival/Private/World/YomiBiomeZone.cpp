@@ -3,6 +3,7 @@
 #include "World/YomiBiomeZone.h"
 #include "World/YomiResourceNode.h"
 #include "AI/YomiEnemyBase.h"
+#include "Core/YomiActorPoolSubsystem.h"
 #include "Components/SphereComponent.h"
 #include "NiagaraComponent.h"
 #include "GameFramework/Character.h"
@@ -88,7 +89,10 @@ void AYomiBiomeZone::SpawnEnemies()
 {
 	if (!GetWorld()) return;
 
-	for (int32 i = 0; i < MaxEnemies; ++i)
+	// Only top the zone back up to MaxEnemies
+	PruneSpawnedEnemies();
+
+	for (int32 i = SpawnedEnemies.Num(); i < MaxEnemies; ++i)
 	{
 		FVector SpawnPoint = GetRandomPointInZone();
 
@@ -98,9 +102,30 @@ void AYomiBiomeZone::SpawnEnemies()
 			int32 RandIdx = FMath::RandRange(0, BiomeData.SpawnableEnemies.Num() - 1);
 			EEnemyType EnemyType = BiomeData.SpawnableEnemies[RandIdx];
 
-			// In full implementation, this would spawn the correct enemy subclass
-			UE_LOG(LogYomiWorld, Verbose, TEXT("Spawning enemy type %d at %s"),
-				static_cast<uint8>(EnemyType), *SpawnPoint.ToString());
+			const TSubclassOf<AYomiEnemyBase>* EnemyClass = EnemyClasses.Find(EnemyType);
+			if (!EnemyClass || !*EnemyClass) continue;
+
+			// Pooled, so enemies killed earlier are recycled rather than spawned anew
+			if (AYomiEnemyBase* Enemy = AYomiEnemyBase::SpawnEnemy(this, *EnemyClass, FTransform(SpawnPoint)))
+			{
+				SpawnedEnemies.Add(Enemy);
+				UE_LOG(LogYomiWorld, Verbose, TEXT("Spawned enemy type %d at %s"),
+					static_cast<uint8>(EnemyType), *SpawnPoint.ToString());
+			}
+		}
+	}
+}
+
+void AYomiBiomeZone::PruneSpawnedEnemies()
+{
+	const UYomiActorPoolSubsystem* Pool = GetWorld() ? GetWorld()->GetSubsystem<UYomiActorPoolSubsystem>() : nullptr;
+
+	for (auto It = SpawnedEnemies.CreateIterator(); It; ++It)
+	{
+		const AYomiEnemyBase* Enemy = It->Get();
+		if (!Enemy || !Enemy->IsAlive() || (Pool && Pool->IsParked(Enemy)))
+		{
+			It.RemoveCurrent();
 		}
 	}
 }
@@ -38,6 +38,7 @@ public:
 protected:
 	virtual void BeginPlay() override;
 	virtual void OnPossess(APawn* InPawn) override;
+	virtual void OnUnPossess() override;
 
 	UFUNCTION()
 	void OnPerceptionUpdated(const TArray<AActor*>& UpdatedActors);
@@ -48,7 +49,14 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "AI|Perception")
 	TObjectPtr<UAISenseConfig_Hearing> HearingConfig;
 
+	/** How often an idle aggressive enemy checks the character registry for targets. */
+	UPROPERTY(EditAnywhere, Category = "AI|Perception")
+	float AggroScanInterval = 0.5f;
+
 private:
 	FVector PatrolCenter;
 	float PatrolRadius = 500.0f;
+
+	FTimerHandle AggroScanTimerHandle;
+	void ScanForAggroTarget();
 };
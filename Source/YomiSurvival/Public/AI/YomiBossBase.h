@@ -27,6 +27,8 @@ class YOMISURVIVAL_API AYomiBossBase : public AYomiEnemyBase
 public:
 	AYomiBossBase();
 
+	virtual EYomiCharacterKind GetCharacterKind() const override { return EYomiCharacterKind::Boss; }
+
 	// ========================================================================
 	// BOSS IDENTITY
 	// ========================================================================
@@ -135,6 +137,7 @@ public:
 protected:
 	virtual void BeginPlay() override;
 	virtual void Tick(float DeltaTime) override;
+	virtual bool NeedsTick() const override { return bEncounterActive || Super::NeedsTick(); }
 	virtual void Die() override;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Boss")
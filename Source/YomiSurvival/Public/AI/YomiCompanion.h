@@ -22,6 +22,8 @@ class YOMISURVIVAL_API AYomiCompanion : public AYomiCharacterBase
 public:
 	AYomiCompanion();
 
+	virtual EYomiCharacterKind GetCharacterKind() const override { return EYomiCharacterKind::Companion; }
+
 	UFUNCTION(BlueprintCallable, Category = "Companion")
 	void InitializeCompanion(ECompanionType InType, AYomiPlayerCharacter* InOwner);
 
@@ -59,6 +61,7 @@ public:
 protected:
 	virtual void BeginPlay() override;
 	virtual void Tick(float DeltaTime) override;
+	virtual bool NeedsTick() const override { return CompanionOwner != nullptr || Super::NeedsTick(); }
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Companion")
 	ECompanionType CompanionType = ECompanionType::None;
@@ -5,24 +5,36 @@
 #include "CoreMinimal.h"
 #include "Character/YomiCharacterBase.h"
 #include "Core/YomiGameTypes.h"
+#include "Core/YomiActorPoolSubsystem.h"
 #include "YomiEnemyBase.generated.h"
 
 class UBehaviorTree;
 class AYomiAIController;
+class AYomiProjectile;
 
 /**
  * Base class for all enemies in Yomi Survival.
  * Yokai, Oni, spirits, bandits, corrupted creatures, etc.
  * Each enemy has attack patterns, loot tables, and biome affinity.
+ * Corpses go back to the actor pool instead of being destroyed.
  */
 UCLASS()
-class YOMISURVIVAL_API AYomiEnemyBase : public AYomiCharacterBase
+class YOMISURVIVAL_API AYomiEnemyBase : public AYomiCharacterBase, public IYomiPoolable
 {
 	GENERATED_BODY()
 
 public:
 	AYomiEnemyBase();
 
+	/**
+	 * Spawn an enemy through the actor pool, reusing a parked corpse of the same class when one is free.
+	 * Use this instead of SpawnActor so Die can hand the enemy back for reuse.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Enemy", meta = (WorldContext = "WorldContextObject"))
+	static AYomiEnemyBase* SpawnEnemy(UObject* WorldContextObject, TSubclassOf<AYomiEnemyBase> EnemyClass, const FTransform& Transform);
+
+	virtual EYomiCharacterKind GetCharacterKind() const override { return EYomiCharacterKind::Enemy; }
+
 	UFUNCTION(BlueprintPure, Category = "Enemy")
 	EEnemyType GetEnemyType() const { return EnemyType; }
 
@@ -38,6 +50,22 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Enemy")
 	float GetAggroRange() const { return AggroRange; }
 
+	UFUNCTION(BlueprintPure, Category = "Enemy")
+	AActor* GetCurrentTarget() const { return CurrentTarget; }
+
+	UFUNCTION(BlueprintPure, Category = "Enemy|Combat")
+	float GetAttackDamage() const { return AttackDamage; }
+
+	UFUNCTION(BlueprintPure, Category = "Enemy|Combat")
+	EDamageType GetAttackDamageType() const { return AttackDamageType; }
+
+	UFUNCTION(BlueprintPure, Category = "Enemy|Combat")
+	float GetAttackCooldown() const { return AttackCooldown; }
+
+	/** Nearest living player or companion within aggro range, from the character registry. */
+	UFUNCTION(BlueprintCallable, Category = "Enemy")
+	AYomiCharacterBase* FindAggroTarget() const;
+
 	/** Called when this enemy detects a player. */
 	UFUNCTION(BlueprintCallable, Category = "Enemy")
 	virtual void OnPlayerDetected(AActor* Player);
@@ -65,6 +93,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Enemy")
 	void SetKilledHonorably(bool bHonorable) { bKilledHonorably = bHonorable; }
 
+	// IYomiPoolable
+	virtual void OnAcquiredFromPool() override;
+	virtual void OnReturnedToPool() override;
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void Die() override;
@@ -99,6 +131,21 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy")
 	float PatrolRadius = 500.0f;
 
+	/** When set, the primary attack is a shot that leads the target instead of a melee hit. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy|Ranged")
+	TSubclassOf<AYomiProjectile> RangedProjectileClass;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy|Ranged")
+	float RangedProjectileSpeed = 2500.0f;
+
+	/** Launch point in actor space. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy|Ranged")
+	FVector RangedMuzzleOffset = FVector(100.0f, 0.0f, 50.0f);
+
+	/** How long the corpse stays for the death animation before returning to the pool. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy")
+	float CorpseLifeSpan = 5.0f;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy|AI")
 	TObjectPtr<UBehaviorTree> BehaviorTree;
 
@@ -112,6 +159,12 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy|Loot")
 	int32 HonorReward = 5;
 
+	/** Fire RangedProjectileClass along this frame's batched aim solution. */
+	void ExecuteRangedAttack();
+
+	/** Keep the aim subsystem solving for CurrentTarget, or stop when there is none. */
+	void UpdateAimTracking();
+
 	// Combat state
 	float AttackCooldownTimer = 0.0f;
 	bool bKilledHonorably = false;
@@ -4,12 +4,33 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Engine/NetSerialization.h"
 #include "Core/YomiGameTypes.h"
 #include "YomiBuildingComponent.generated.h"
 
 class AYomiBuildingPiece;
 class UYomiInventoryComponent;
 
+/**
+ * One blueprint piece as sent to the server: an index into the building piece table
+ * instead of its name, and a quantised yaw-only offset instead of a full transform.
+ */
+USTRUCT()
+struct FYomiBlueprintSlot
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	uint16 PieceIndex = 0;
+
+	/** Yaw relative to the blueprint origin, compressed with FRotator::CompressAxisToShort. */
+	UPROPERTY()
+	uint16 Yaw = 0;
+
+	UPROPERTY()
+	FVector_NetQuantize10 Offset;
+};
+
 /**
  * Component that handles the building system for the player.
  * Manages build mode, ghost placement, snapping, and construction.
@@ -74,6 +95,35 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Building")
 	void UpdateGhostPlacement();
 
+	// ========================================================================
+	// BLUEPRINTS
+	// ========================================================================
+
+	/** Save a group of placed pieces as a reusable blueprint, relative to the first piece. */
+	UFUNCTION(BlueprintCallable, Category = "Building|Blueprints")
+	bool SaveBlueprint(FName BlueprintID, const TArray<AYomiBuildingPiece*>& Pieces);
+
+	UFUNCTION(BlueprintCallable, Category = "Building|Blueprints")
+	void DeleteBlueprint(FName BlueprintID);
+
+	UFUNCTION(BlueprintPure, Category = "Building|Blueprints")
+	TArray<FName> GetSavedBlueprintIDs() const;
+
+	/** Total resources needed to build every piece of a blueprint. */
+	UFUNCTION(BlueprintPure, Category = "Building|Blueprints")
+	TMap<EResourceType, int32> GetBlueprintCost(const FBuildingBlueprint& Blueprint) const;
+
+	/**
+	 * Place a saved blueprint at the current placement location and rotation.
+	 * Sent to the server as a single request: one resource check and consumption,
+	 * one batched validation, then the pieces spawn over several frames.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Building|Blueprints")
+	bool PlaceBlueprint(FName BlueprintID);
+
+	/** Called by the building subsystem once every piece of a blueprint is spawned. Server only. */
+	void NotifyBlueprintPlaced(FName BlueprintID, const TArray<AYomiBuildingPiece*>& PlacedPieces);
+
 	// ========================================================================
 	// DEMOLITION
 	// ========================================================================
@@ -97,10 +147,23 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Events")
 	FOnPiecePlaced OnPiecePlaced;
 
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnBlueprintPlaced, FName, BlueprintID, int32, NumPieces);
+
+	/** Fires on the server and on the owning client once every piece of a blueprint is spawned. */
+	UPROPERTY(BlueprintAssignable, Category = "Events")
+	FOnBlueprintPlaced OnBlueprintPlaced;
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
+	/** Slots are compact so even a MaxBlueprintPieces request stays a few kilobytes. */
+	UFUNCTION(Server, Reliable)
+	void ServerPlaceBlueprint(FName BlueprintID, const TArray<FYomiBlueprintSlot>& Slots, FTransform Origin);
+
+	UFUNCTION(Client, Reliable)
+	void ClientBlueprintPlaced(FName BlueprintID, int32 NumPieces);
+
 private:
 	bool bInBuildMode = false;
 	FName SelectedPieceID;
@@ -121,10 +184,24 @@ private:
 	UPROPERTY(EditAnywhere, Category = "Building")
 	TObjectPtr<UDataTable> BuildingPieceDataTable;
 
+	/** Upper bound on pieces in a single blueprint placement request. */
+	UPROPERTY(EditAnywhere, Category = "Building|Blueprints")
+	int32 MaxBlueprintPieces = 256;
+
+	/** Furthest a blueprint piece may sit from the blueprint origin. */
+	UPROPERTY(EditAnywhere, Category = "Building|Blueprints")
+	float MaxBlueprintExtent = 3000.0f;
+
+	UPROPERTY(SaveGame)
+	TMap<FName, FBuildingBlueprint> SavedBlueprints;
+
 	// Available pieces for building (cached)
 	TArray<FName> AvailablePieceIDs;
+	TMap<FName, FBuildingPieceData> PieceDataByID;
 	int32 CurrentPieceIndex = 0;
 
+	const FBuildingPieceData* FindPieceData(FName PieceID) const;
+
 	FVector GetPlacementLocation() const;
 	FRotator GetPlacementRotation() const;
 	bool CheckPlacementCollision(FVector Location) const;
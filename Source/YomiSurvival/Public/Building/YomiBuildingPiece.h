@@ -9,6 +9,7 @@
 
 class UStaticMeshComponent;
 class UBoxComponent;
+class UNavModifierComponent;
 
 /**
  * A placed building piece in the world.
@@ -38,6 +39,20 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Building")
 	float TakeDamage(float DamageAmount, EDamageType DamageType);
 
+	/** Apply damage that has already been scaled by material resistance. Returns damage dealt. */
+	float ApplyResolvedDamage(float FinalDamage);
+
+	/** Adopt a quantised health value received from a batched server update. */
+	void SetHealthFromBatch(uint8 HealthByte);
+
+	/**
+	 * On clients, look up PieceData for the replicated piece ID if it has not been resolved yet.
+	 * Called when the ID arrives and again whenever new piece definitions become known.
+	 */
+	void ResolvePieceData();
+
+	uint8 GetReplicatedHealthByte() const { return ReplicatedHealth; }
+
 	UFUNCTION(BlueprintCallable, Category = "Building")
 	void Repair(float Amount = -1.0f);
 
@@ -54,11 +69,26 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Building")
 	bool IsGhost() const { return bIsGhost; }
 
+	/**
+	 * While under construction the piece is represented on the navmesh by a cheap
+	 * high-cost modifier volume instead of its rasterised mesh.
+	 */
+	void SetUnderConstruction(bool bConstructing);
+
+	UFUNCTION(BlueprintPure, Category = "Building")
+	bool IsUnderConstruction() const { return bUnderConstruction; }
+
 	/** Get snap points for other pieces to connect to. */
 	UFUNCTION(BlueprintPure, Category = "Building")
 	TArray<FVector> GetSnapPoints() const;
 
+	/** Radius of a sphere enclosing the piece, used by the building spatial index. */
+	float GetFootprintRadius() const { return PieceData.SnapSize.Size() * 0.5f; }
+
 protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
 	TObjectPtr<UStaticMeshComponent> MeshComponent;
 
@@ -68,10 +98,23 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Building")
 	FBuildingPieceData PieceData;
 
-	UPROPERTY(BlueprintReadOnly, Category = "Building", Replicated)
+	UPROPERTY(BlueprintReadOnly, Category = "Building")
 	float CurrentHealth;
 
+	/** Health quantised to a byte (0-255 of MaxHealth) for replication. */
+	UPROPERTY(ReplicatedUsing = OnRep_HealthByte)
+	uint8 ReplicatedHealth = 255;
+
+	/** PieceData is not replicated; clients resolve it from this ID through the building subsystem. */
+	UPROPERTY(ReplicatedUsing = OnRep_PieceID)
+	FName ReplicatedPieceID;
+
 	bool bIsGhost = false;
+	bool bUnderConstruction = false;
+
+	/** Created only while under construction. */
+	UPROPERTY()
+	TObjectPtr<UNavModifierComponent> ConstructionNavModifier;
 
 	UPROPERTY(EditAnywhere, Category = "Building|Materials")
 	TObjectPtr<UMaterialInterface> GhostMaterialValid;
@@ -83,5 +126,20 @@ protected:
 
 	void OnPieceDestroyed();
 
+	void RegisterWithSubsystem();
+	void UnregisterFromSubsystem();
+
+	/** Adopt piece data and refresh everything derived from it: mesh, collision and the spatial index. */
+	void ApplyPieceData(const FBuildingPieceData& InData);
+
+	/** Requantise health, wake the piece for one replication update and queue the change for listeners. Server only. */
+	void MarkHealthDirty(float DamageDealt = 0.0f);
+
+	UFUNCTION()
+	void OnRep_HealthByte();
+
+	UFUNCTION()
+	void OnRep_PieceID();
+
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 };
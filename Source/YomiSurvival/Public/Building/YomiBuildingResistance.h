@@ -0,0 +1,68 @@
+// Copyright (c) 2026 Yomi Survival. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/YomiGameTypes.h"
+
+/**
+ * Material-by-damage-type resistance table for building pieces.
+ * The table is generated at compile time from EBuildingMaterial and EDamageType,
+ * so damage resolution is a single indexed load instead of a per-call switch.
+ * Negative values mean extra vulnerability (bamboo burns).
+ */
+namespace YomiBuildingResistance
+{
+	constexpr int32 NumMaterials = static_cast<int32>(EBuildingMaterial::MAX);
+	constexpr int32 NumDamageTypes = static_cast<int32>(EDamageType::MAX);
+
+	/** Design rules for a single material/damage pair. Only evaluated when building the table. */
+	constexpr float ComputeResistance(EBuildingMaterial Material, EDamageType DamageType)
+	{
+		switch (Material)
+		{
+		case EBuildingMaterial::Bamboo:
+			return DamageType == EDamageType::Fire ? -0.5f : 0.0f; // Extra vulnerable to fire
+		case EBuildingMaterial::Stone:
+			if (DamageType == EDamageType::Physical) return 0.5f;
+			if (DamageType == EDamageType::Fire) return 0.8f;
+			return 0.0f;
+		case EBuildingMaterial::Iron:
+			return DamageType == EDamageType::Physical ? 0.6f : 0.0f;
+		case EBuildingMaterial::SpiritForged:
+			return 0.3f; // Resistant to all damage types
+		default:
+			return 0.0f;
+		}
+	}
+
+	struct FResistanceTable
+	{
+		float Values[NumMaterials][NumDamageTypes] = {};
+	};
+
+	constexpr FResistanceTable BuildTable()
+	{
+		FResistanceTable Result;
+		for (int32 M = 0; M < NumMaterials; ++M)
+		{
+			for (int32 D = 0; D < NumDamageTypes; ++D)
+			{
+				Result.Values[M][D] = ComputeResistance(static_cast<EBuildingMaterial>(M), static_cast<EDamageType>(D));
+			}
+		}
+		return Result;
+	}
+
+	inline constexpr FResistanceTable Table = BuildTable();
+
+	static_assert(Table.Values[static_cast<int32>(EBuildingMaterial::Stone)][static_cast<int32>(EDamageType::Fire)] == 0.8f,
+		"Building resistance table out of sync with design rules");
+
+	FORCEINLINE float Get(EBuildingMaterial Material, EDamageType DamageType)
+	{
+		const int32 M = static_cast<int32>(Material);
+		const int32 D = static_cast<int32>(DamageType);
+		return (M < NumMaterials && D < NumDamageTypes) ? Table.Values[M][D] : 0.0f;
+	}
+}
@@ -0,0 +1,207 @@
+// Copyright (c) 2026 Yomi Survival. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Core/YomiGameTypes.h"
+#include "Building/YomiShelterField.h"
+#include "YomiBuildingSubsystem.generated.h"
+
+class AYomiBuildingPiece;
+class UYomiBuildingComponent;
+
+/**
+ * A single building piece health change, sent to clients as part of a batch.
+ */
+USTRUCT(BlueprintType)
+struct FYomiBuildingHealthUpdate
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Building")
+	TObjectPtr<AYomiBuildingPiece> Piece = nullptr;
+
+	/** New health quantised to a byte of the piece's MaxHealth, matching the replicated property. */
+	UPROPERTY(BlueprintReadOnly, Category = "Building")
+	uint8 HealthByte = 0;
+
+	/** Total damage taken this frame. Zero for repairs. */
+	UPROPERTY(BlueprintReadOnly, Category = "Building")
+	float DamageDealt = 0.0f;
+};
+
+/**
+ * World subsystem that owns the building spatial index.
+ * Every placed (non-ghost) building piece is bucketed into a uniform grid so that
+ * siege damage, snapping and base queries touch only nearby cells instead of the physics scene.
+ * Also maintains the shelter/comfort field that rest and weather systems poll,
+ * spawns blueprint placements over several frames, and batches the navmesh
+ * updates that placing and destroying pieces cause.
+ */
+UCLASS(Config = Game)
+class YOMISURVIVAL_API UYomiBuildingSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UYomiBuildingSubsystem, STATGROUP_Tickables); }
+
+	// ========================================================================
+	// SPATIAL INDEX
+	// ========================================================================
+
+	void RegisterPiece(AYomiBuildingPiece* Piece);
+	void UnregisterPiece(AYomiBuildingPiece* Piece);
+
+	/** Gather all registered pieces whose footprint intersects the sphere. */
+	void GatherPiecesInRadius(const FVector& Origin, float Radius, TArray<AYomiBuildingPiece*>& OutPieces) const;
+
+	UFUNCTION(BlueprintPure, Category = "Building")
+	int32 GetNumRegisteredPieces() const { return PieceCells.Num(); }
+
+	/**
+	 * Validate a batch of prospective placements against the spatial index in one pass.
+	 * A placement is blocked when an existing piece, an earlier placement in the same call
+	 * or a piece still queued for spawning already occupies its slot.
+	 * Returns true if every placement is free; blocked indices are appended to OutBlocked.
+	 */
+	bool ValidatePlacements(const TArray<FTransform>& Transforms, const TArray<FVector>& SnapSizes, TArray<int32>* OutBlocked = nullptr) const;
+
+	// ========================================================================
+	// PIECE DEFINITIONS
+	// ========================================================================
+
+	/**
+	 * Make piece data known by ID so replicated pieces can rebuild their PieceData on clients.
+	 * Pieces already in the world that were waiting for one of these IDs resolve immediately.
+	 */
+	void AddPieceDefinitions(const TMap<FName, FBuildingPieceData>& Definitions);
+
+	const FBuildingPieceData* FindPieceDefinition(FName PieceID) const { return PieceDefinitions.Find(PieceID); }
+
+	// ========================================================================
+	// BATCHED PLACEMENT
+	// ========================================================================
+
+	/**
+	 * Queue a validated, already paid-for set of pieces for spawning.
+	 * Server only. Pieces are spawned at most MaxPiecesSpawnedPerFrame per tick and
+	 * the requester is notified once when the whole batch is in the world.
+	 */
+	void EnqueuePlacementBatch(FName BlueprintID, TArray<FBuildingPieceData>&& PieceData, TArray<FTransform>&& Transforms,
+		AActor* Owner, UYomiBuildingComponent* Requester);
+
+	UFUNCTION(BlueprintPure, Category = "Building")
+	int32 GetNumPendingPlacements() const;
+
+	// ========================================================================
+	// NAVIGATION
+	// ========================================================================
+
+	/**
+	 * Hold navmesh rebuilds for a short window so dirty areas from many building
+	 * changes accumulate and each affected tile is rebuilt once.
+	 * The window starts at the first change and is not extended by later ones.
+	 * Server only; does nothing without a navigation system.
+	 */
+	void DeferNavigationRebuild();
+
+	// ========================================================================
+	// SHELTER & COMFORT
+	// ========================================================================
+
+	/** Summed comfort of building pieces around a location. Cached, safe to poll every frame. */
+	UFUNCTION(BlueprintPure, Category = "Building|Shelter")
+	float GetComfortAtLocation(FVector Location) const { return ShelterField.GetComfortAt(Location); }
+
+	/** Whether a roof piece covers this location. Cached, safe to poll every frame. */
+	UFUNCTION(BlueprintPure, Category = "Building|Shelter")
+	bool IsLocationSheltered(FVector Location) const { return ShelterField.IsShelteredAt(Location); }
+
+	// ========================================================================
+	// AREA DAMAGE
+	// ========================================================================
+
+	/**
+	 * Apply damage to every building piece within Radius of Origin in a single pass.
+	 * Server only. Health changes are sent to clients as one batched update.
+	 * Returns the number of pieces damaged.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Building")
+	int32 ApplyAreaDamage(FVector Origin, float Radius, float DamageAmount, EDamageType DamageType, bool bLinearFalloff = false);
+
+	/**
+	 * Add a piece's new health to this frame's batch. Server only.
+	 * The replicated health byte is what keeps clients correct; the batch only tells listeners what changed.
+	 */
+	void QueueHealthUpdate(AYomiBuildingPiece* Piece, float DamageDealt);
+
+	/** Called on every machine when a batched health update arrives. */
+	void HandleHealthBatch(const TArray<FYomiBuildingHealthUpdate>& Updates);
+
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnBuildingPiecesDamaged, const TArray<FYomiBuildingHealthUpdate>&, Updates);
+
+	UPROPERTY(BlueprintAssignable, Category = "Events")
+	FOnBuildingPiecesDamaged OnBuildingPiecesDamaged;
+
+private:
+	struct FPlacementBatch
+	{
+		FName BlueprintID;
+		TArray<FBuildingPieceData> PieceData;
+		TArray<FTransform> Transforms;
+		TWeakObjectPtr<AActor> Owner;
+		TWeakObjectPtr<UYomiBuildingComponent> Requester;
+
+		/** Index of the next piece to spawn. */
+		int32 NextIndex = 0;
+		TArray<TWeakObjectPtr<AYomiBuildingPiece>> SpawnedPieces;
+	};
+
+	/** Spawn budget for blueprint placements, shared across all pending batches. */
+	UPROPERTY(Config)
+	int32 MaxPiecesSpawnedPerFrame = 8;
+
+	/** How long building changes are collected before the navmesh is allowed to rebuild. */
+	UPROPERTY(Config)
+	float NavRebuildBatchWindow = 0.25f;
+
+	/** Two pieces closer than this fraction of the smaller snap size occupy the same slot. */
+	static constexpr float SlotOverlapFraction = 0.25f;
+
+	/** Edge length of a spatial index cell. Two standard snap units. */
+	static constexpr float CellSize = 400.0f;
+
+	FIntVector GetCellCoord(const FVector& Location) const;
+
+	void ProcessPendingPlacements();
+	void ReleaseNavigationLock();
+	void FlushHealthUpdates();
+
+	TMap<FIntVector, TArray<TWeakObjectPtr<AYomiBuildingPiece>>> Cells;
+	TMap<TWeakObjectPtr<AYomiBuildingPiece>, FIntVector> PieceCells;
+
+	/** Largest footprint radius seen, used to pad cell queries. */
+	float MaxPieceRadius = 0.0f;
+
+	/** Updated incrementally as pieces register and unregister. */
+	FYomiShelterField ShelterField;
+
+	TArray<FPlacementBatch> PendingBatches;
+
+	/** Every piece definition seen so far, keyed by piece ID. */
+	TMap<FName, FBuildingPieceData> PieceDefinitions;
+
+	/** Health changes collected this frame, sent as one multicast from Tick. */
+	UPROPERTY()
+	TArray<FYomiBuildingHealthUpdate> PendingHealthUpdates;
+
+	/** Index into PendingHealthUpdates per piece, so repeated hits update one entry. */
+	TMap<TObjectKey<AYomiBuildingPiece>, int32> PendingHealthIndices;
+
+	bool bNavigationLocked = false;
+	double NavigationUnlockTime = 0.0;
+};
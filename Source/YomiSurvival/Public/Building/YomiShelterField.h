@@ -0,0 +1,66 @@
+// Copyright (c) 2026 Yomi Survival. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AYomiBuildingPiece;
+
+/**
+ * Voxelised shelter and comfort field around building clusters.
+ * Each cell counts the roofs above it and sums the comfort of nearby pieces.
+ * Pieces add and remove their exact contribution when placed or destroyed,
+ * so reading a player's comfort or "under roof" status is a single cell lookup.
+ */
+class YOMISURVIVAL_API FYomiShelterField
+{
+public:
+	/** Edge length of a field cell. Matches the default building snap size. */
+	static constexpr float CellSize = 200.0f;
+
+	/** How many cells below a roof piece count as sheltered. */
+	static constexpr int32 ShelterDepthCells = 3;
+
+	/** Horizontal reach of a comfort piece (campfire, tatami, shrine...). */
+	static constexpr float ComfortRadius = 1000.0f;
+
+	/** Vertical reach of a comfort piece, in cells above and below it. */
+	static constexpr int32 ComfortHeightCells = 2;
+
+	void AddPiece(const AYomiBuildingPiece* Piece);
+	void RemovePiece(const AYomiBuildingPiece* Piece);
+
+	float GetComfortAt(const FVector& Location) const;
+	bool IsShelteredAt(const FVector& Location) const;
+
+	int32 GetNumCells() const { return Cells.Num(); }
+
+private:
+	struct FCell
+	{
+		int32 RoofCount = 0;
+		float Comfort = 0.0f;
+
+		bool IsEmpty() const { return RoofCount <= 0 && FMath::IsNearlyZero(Comfort); }
+	};
+
+	/** What a piece wrote into the field, so removal undoes exactly that. */
+	struct FContribution
+	{
+		bool bRoof = false;
+		FIntVector RoofMin = FIntVector::ZeroValue;
+		FIntVector RoofMax = FIntVector::ZeroValue;
+
+		float Comfort = 0.0f;
+		FIntVector ComfortCenter = FIntVector::ZeroValue;
+	};
+
+	static FIntVector ToCell(const FVector& Location);
+
+	void ApplyRoof(const FContribution& Contribution, int32 Sign);
+	void ApplyComfort(const FContribution& Contribution, float Sign);
+	void CompactCell(const FIntVector& Coord);
+
+	TMap<FIntVector, FCell> Cells;
+	TMap<TObjectKey<AYomiBuildingPiece>, FContribution> Contributions;
+};
@@ -9,6 +9,62 @@
 
 class UYomiCombatComponent;
 
+/**
+ * One source's contribution to every attribute: a flat amount and a fractional multiplier
+ * (0.2 is +20%). A character folds all its layers into (base + additive) * (1 + multiplier).
+ */
+struct FYomiModifierLayer
+{
+	static constexpr int32 NumAttributes = static_cast<int32>(EYomiAttribute::MAX);
+
+	float Additive[NumAttributes] = {};
+	float Multiplier[NumAttributes] = {};
+
+	void Add(EYomiAttribute Attribute, float InAdditive, float InMultiplier = 0.0f)
+	{
+		const int32 Index = static_cast<int32>(Attribute);
+		Additive[Index] += InAdditive;
+		Multiplier[Index] += InMultiplier;
+	}
+};
+
+/**
+ * Tracks what listeners were last told about one stat. A change is only worth sending once it
+ * has moved a whole quantum, crossed empty, critical or full, or, for a low-frequency UI path,
+ * sat unsent for longer than an interval.
+ */
+struct FYomiStatNotifier
+{
+	float SentValue = -1.0f;
+	float SentMax = -1.0f;
+	float SentTime = 0.0f;
+	bool bPending = false;
+
+	static int32 GetBand(float Value, float Max, float CriticalFraction)
+	{
+		if (Value <= 0.0f) return 0;
+		if (Value >= Max) return 3;
+		return Value <= Max * CriticalFraction ? 1 : 2;
+	}
+
+	bool ShouldSend(float Value, float Max, float Quantum, float CriticalFraction, float Interval, float Now) const
+	{
+		if (!bPending) return false;
+		if (Max != SentMax) return true;
+		if (GetBand(Value, Max, CriticalFraction) != GetBand(SentValue, SentMax, CriticalFraction)) return true;
+		if (FMath::Abs(Value - SentValue) >= Quantum) return true;
+		return Interval > 0.0f && Value != SentValue && Now - SentTime >= Interval;
+	}
+
+	void MarkSent(float Value, float Max, float Now)
+	{
+		SentValue = Value;
+		SentMax = Max;
+		SentTime = Now;
+		bPending = false;
+	}
+};
+
 /**
  * Base character class for all characters in Yomi Survival.
  * Provides health, stamina, damage handling, and status effects.
@@ -25,26 +81,41 @@ public:
 	// HEALTH & STAMINA
 	// ========================================================================
 
+	/** Evaluated from the regeneration anchor, so it is current without the character ticking. */
 	UFUNCTION(BlueprintPure, Category = "Stats")
-	float GetCurrentHealth() const { return CurrentHealth; }
+	float GetCurrentHealth() const;
 
 	UFUNCTION(BlueprintPure, Category = "Stats")
 	float GetMaxHealth() const { return MaxHealth; }
 
+	/** Change the unmodified maximum; modifiers still apply on top and the new value is marked for replication. Server only. */
+	UFUNCTION(BlueprintCallable, Category = "Stats")
+	void SetMaxHealth(float NewMaxHealth);
+
 	UFUNCTION(BlueprintPure, Category = "Stats")
-	float GetHealthPercent() const { return MaxHealth > 0.0f ? CurrentHealth / MaxHealth : 0.0f; }
+	float GetHealthPercent() const { return MaxHealth > 0.0f ? GetCurrentHealth() / MaxHealth : 0.0f; }
 
 	UFUNCTION(BlueprintPure, Category = "Stats")
-	float GetCurrentStamina() const { return CurrentStamina; }
+	float GetCurrentStamina() const;
 
 	UFUNCTION(BlueprintPure, Category = "Stats")
 	float GetMaxStamina() const { return MaxStamina; }
 
+	/** Change the unmodified maximum; modifiers still apply on top and the new value is marked for replication. Server only. */
+	UFUNCTION(BlueprintCallable, Category = "Stats")
+	void SetMaxStamina(float NewMaxStamina);
+
+	UFUNCTION(BlueprintPure, Category = "Stats")
+	float GetStaminaRegenRate() const { return StaminaRegenRate; }
+
 	UFUNCTION(BlueprintPure, Category = "Stats")
-	float GetStaminaPercent() const { return MaxStamina > 0.0f ? CurrentStamina / MaxStamina : 0.0f; }
+	float GetStaminaRegenDelay() const { return StaminaRegenDelay; }
 
 	UFUNCTION(BlueprintPure, Category = "Stats")
-	bool IsAlive() const { return CurrentHealth > 0.0f; }
+	float GetStaminaPercent() const { return MaxStamina > 0.0f ? GetCurrentStamina() / MaxStamina : 0.0f; }
+
+	UFUNCTION(BlueprintPure, Category = "Stats")
+	bool IsAlive() const { return HealthStat.Value > 0.0f; }
 
 	UFUNCTION(BlueprintCallable, Category = "Stats")
 	virtual void Heal(float Amount);
@@ -55,20 +126,82 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Stats")
 	bool ConsumeStamina(float Amount);
 
+	// ========================================================================
+	// ATTRIBUTES
+	// ========================================================================
+
+	/** Aggregated value over every modifier source, cached until a modifier changes. */
+	UFUNCTION(BlueprintPure, Category = "Stats")
+	float GetAttribute(EYomiAttribute Attribute) const
+	{
+		const int32 Index = static_cast<int32>(Attribute);
+		return Index < NumAttributes ? AttributeValues[Index] : 0.0f;
+	}
+
+	/** Replace everything Source contributes. Only attributes whose modifiers changed are recomputed. Server only. */
+	void SetModifierLayer(EYomiModifierSource Source, const FYomiModifierLayer& Layer);
+
+	UFUNCTION(BlueprintCallable, Category = "Stats")
+	void ClearModifierLayer(EYomiModifierSource Source);
+
+	/** Change the unmodified value, e.g. a companion's type-specific health. */
+	UFUNCTION(BlueprintCallable, Category = "Stats")
+	void SetAttributeBase(EYomiAttribute Attribute, float Value);
+
 	// ========================================================================
 	// DAMAGE
 	// ========================================================================
 
+	/** Apply a single hit immediately. Gameplay hits should go through UYomiDamageSubsystem instead. */
 	UFUNCTION(BlueprintCallable, Category = "Combat")
 	virtual float ApplyDamage(float DamageAmount, EDamageType DamageType, AActor* DamageCauser);
 
+	/**
+	 * Apply damage that has already been scaled by resistance, with a single round of notifications.
+	 * Used by the damage subsystem to commit a frame's worth of hits at once. Returns damage dealt.
+	 */
+	float ApplyResolvedDamage(float FinalDamage, EDamageType DamageType, AActor* DamageCauser);
+
 	UFUNCTION(BlueprintPure, Category = "Combat")
 	virtual float GetDamageResistance(EDamageType DamageType) const;
 
+	UFUNCTION(BlueprintCallable, Category = "Combat")
+	void SetDamageResistance(EDamageType DamageType, float Resistance);
+
+	// ========================================================================
+	// TEAMS
+	// ========================================================================
+
+	UFUNCTION(BlueprintPure, Category = "Combat")
+	EYomiTeam GetTeam() const { return Team; }
+
+	UFUNCTION(BlueprintPure, Category = "Combat")
+	virtual EYomiCharacterKind GetCharacterKind() const { return EYomiCharacterKind::None; }
+
+	// ========================================================================
+	// STATUS EFFECTS
+	// ========================================================================
+
+	/** Active effects for the HUD. Only replicated to the owning client. */
+	UFUNCTION(BlueprintPure, Category = "Status")
+	const TArray<FYomiStatusEffectIcon>& GetActiveStatusEffects() const { return ActiveStatusEffects; }
+
+	/** Movement speed multiplier from every modifier source, layered over whatever speed the character sets itself. */
+	UFUNCTION(BlueprintPure, Category = "Status")
+	float GetMoveSpeedScale() const { return MoveSpeedScale; }
+
+	/** Called by UYomiStatusEffectSubsystem whenever this character's effects change. Server only. */
+	void SetStatusEffects(TArrayView<const FYomiStatusEffectIcon> Icons, float SpeedScale);
+
 	// ========================================================================
 	// DELEGATES
 	// ========================================================================
 
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnStatusEffectsChanged, const TArray<FYomiStatusEffectIcon>&, StatusEffects);
+
+	UPROPERTY(BlueprintAssignable, Category = "Events")
+	FOnStatusEffectsChanged OnStatusEffectsChanged;
+
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnDamageTaken, float, DamageAmount, EDamageType, DamageType, AActor*, DamageCauser);
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnDeath);
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnHealthChanged, float, CurrentHealth, float, MaxHealth);
@@ -80,29 +213,60 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Events")
 	FOnDeath OnDeath;
 
+	/** Coalesced: at most once a frame, and only for changes that pass the notify quantum or a threshold. */
 	UPROPERTY(BlueprintAssignable, Category = "Events")
 	FOnHealthChanged OnHealthChanged;
 
+	/** Coalesced like OnHealthChanged. */
 	UPROPERTY(BlueprintAssignable, Category = "Events")
 	FOnStaminaChanged OnStaminaChanged;
 
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnAttributeChanged, EYomiAttribute, Attribute, float, NewValue);
+
+	/** Fired once per attribute whose aggregated value actually changed. Server only. */
+	UPROPERTY(BlueprintAssignable, Category = "Events")
+	FOnAttributeChanged OnAttributeChanged;
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaTime) override;
 
+	/**
+	 * Whether Tick still has work. Once this is false Tick switches itself off, and a queued stat
+	 * notification switches it back on. Subclasses with per-frame work of their own extend it.
+	 */
+	virtual bool NeedsTick() const;
+
+	/** Match the tick to NeedsTick, after a subclass starts or stops its own per-frame work. */
+	void RefreshTickEnabled();
+
 	virtual void Die();
 
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combat")
+	EYomiTeam Team = EYomiTeam::None;
+
+	/** Push the alive flag to the character registry. */
+	void UpdateRegistryAliveState();
+
 	// Stats
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stats", ReplicatedUsing = OnRep_CurrentHealth)
-	float CurrentHealth;
+	/** Health and stamina regenerate in closed form; see FYomiRegenStat. Only the owner gets the anchors. */
+	UPROPERTY(ReplicatedUsing = OnRep_HealthStat)
+	FYomiRegenStat HealthStat;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stats", Replicated)
+	/** Push-model replicated; written only through the MaxHealth attribute. Use SetMaxHealth at runtime. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stats", ReplicatedUsing = OnRep_MaxHealth)
 	float MaxHealth = 100.0f;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stats", ReplicatedUsing = OnRep_CurrentStamina)
-	float CurrentStamina;
+	/** Health quantised to a byte (0-255 of MaxHealth) for everyone but the owner. */
+	UPROPERTY(ReplicatedUsing = OnRep_HealthByte)
+	uint8 ReplicatedHealth = 255;
+
+	UPROPERTY(ReplicatedUsing = OnRep_StaminaStat)
+	FYomiRegenStat StaminaStat;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stats", Replicated)
+	/** Push-model replicated like MaxHealth. Use SetMaxStamina at runtime. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stats", Replicated)
 	float MaxStamina = 100.0f;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stats")
@@ -114,18 +278,123 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stats")
 	float StaminaRegenDelay = 1.0f;
 
-	float StaminaRegenTimer = 0.0f;
+	/** Server world time the regeneration anchors are measured in; also used on clients. */
+	float GetRegenTime() const;
+
+	/**
+	 * Re-anchor every regenerating stat at its current rate. Call whenever anything that feeds a
+	 * rate changes. Regeneration itself is never integrated per frame; Tick only runs while a
+	 * notification is pending, the server's health byte is stepping, or a bound listener is
+	 * watching a stat move.
+	 */
+	virtual void UpdateRegenRates();
 
-	// Damage resistances
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
+	/** Per-second rates while alive; subclasses add their own sources. */
+	virtual float CalculateHealthRegen() const { return HealthRegenRate; }
+	virtual float CalculateStaminaRegen() const { return StaminaRegenRate; }
+
+	/** Queue a notification and mark the stat for replication after writing it. */
+	void MarkHealthDirty();
+	void MarkStaminaDirty();
+
+	/** Step the health byte if the current health no longer rounds to it. Server only. */
+	void UpdateReplicatedHealth();
+
+	// Stat notifications
+	/** Smallest change in a stat that is sent on its own, e.g. half a hit point or one pixel of the bar. */
+	UPROPERTY(EditAnywhere, Category = "Stats|Notifications", meta = (ClampMin = "0"))
+	float StatNotifyQuantum = 0.5f;
+
+	/** Fraction of the maximum at or below which a stat is critical; crossing it is always sent. */
+	UPROPERTY(EditAnywhere, Category = "Stats|Notifications", meta = (ClampMin = "0", ClampMax = "1"))
+	float StatCriticalFraction = 0.25f;
+
+	/** When above zero, changes smaller than the quantum are still sent this often, for bars that should drift smoothly. */
+	UPROPERTY(EditAnywhere, Category = "Stats|Notifications", meta = (ClampMin = "0"))
+	float StatNotifyInterval = 0.0f;
+
+	FYomiStatNotifier HealthNotifier;
+	FYomiStatNotifier StaminaNotifier;
+
+	/** Broadcast every stat whose pending change is worth sending. Called from Tick while it runs. */
+	virtual void FlushStatNotifications();
+
+	/** Mark Notifier's stat as changed and wake Tick to send it. */
+	void QueueStatNotification(FYomiStatNotifier& Notifier);
+
+	/** Whether Notifier's pending change should go out now; marks it sent if so. */
+	bool ConsumeStatNotification(FYomiStatNotifier& Notifier, float Value, float Max);
+
+	// Damage resistances, authored as a map and flattened into ResistanceTable
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combat")
 	TMap<EDamageType, float> DamageResistances;
 
+	static constexpr int32 NumDamageTypes = static_cast<int32>(EDamageType::MAX);
+
+	/** Clamped resistance per EDamageType, indexed directly on every hit. */
+	float ResistanceTable[NumDamageTypes] = {};
+
+	void RebuildResistanceTable();
+
+	// Attributes
+	static constexpr int32 NumAttributes = FYomiModifierLayer::NumAttributes;
+	static constexpr int32 NumModifierSources = static_cast<int32>(EYomiModifierSource::MAX);
+	static_assert(NumAttributes <= 32, "DirtyAttributes is a 32-bit mask");
+
+	float AttributeBase[NumAttributes] = {};
+	float AttributeValues[NumAttributes] = {};
+	FYomiModifierLayer ModifierLayers[NumModifierSources];
+
+	/** One bit per attribute whose modifiers changed since it was last aggregated. */
+	uint32 DirtyAttributes = 0;
+
+	/** Capture the authored stats as attribute bases. Called once from BeginPlay. */
+	virtual void InitializeAttributes();
+
+	/** Re-aggregate the dirty attributes and push those that changed into gameplay. */
+	void RefreshAttributes();
+
+	/** Push a newly aggregated value into the stat it drives. */
+	virtual void ApplyAttribute(EYomiAttribute Attribute, float Value);
+
+	/** Write a new maximum, keep the current value under it and mark both for replication. */
+	void ApplyMaxHealth(float Value);
+	void ApplyMaxStamina(float Value);
+
+	/** The MoveSpeed attribute, replicated so the owning client predicts with the same speed. */
+	UPROPERTY(ReplicatedUsing = OnRep_MoveSpeedScale)
+	float MoveSpeedScale = 1.0f;
+
+	/** Scale currently baked into MaxWalkSpeed. */
+	float AppliedMoveSpeedScale = 1.0f;
+
+	void ApplyMoveSpeedScale();
+
+	// Status effects
+	UPROPERTY(ReplicatedUsing = OnRep_ActiveStatusEffects)
+	TArray<FYomiStatusEffectIcon> ActiveStatusEffects;
+
 	// Replication
 	UFUNCTION()
-	void OnRep_CurrentHealth();
+	void OnRep_HealthStat();
+
+	UFUNCTION()
+	void OnRep_HealthByte();
+
+	UFUNCTION()
+	void OnRep_MaxHealth();
+
+	/** Take health from the byte on clients that do not own this character. */
+	void ApplyReplicatedHealth();
+
+	UFUNCTION()
+	virtual void OnRep_StaminaStat();
+
+	UFUNCTION()
+	void OnRep_ActiveStatusEffects();
 
 	UFUNCTION()
-	void OnRep_CurrentStamina();
+	void OnRep_MoveSpeedScale();
 
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 };
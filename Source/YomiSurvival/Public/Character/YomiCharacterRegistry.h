@@ -0,0 +1,119 @@
+// Copyright (c) 2026 Yomi Survival. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Core/YomiGameTypes.h"
+#include "YomiCharacterRegistry.generated.h"
+
+class AYomiCharacterBase;
+
+/**
+ * Which characters a registry query may return.
+ */
+struct FYomiCharacterFilter
+{
+	/** Skip characters allied with this team. None disables the check. */
+	EYomiTeam ExcludeAlliesOf = EYomiTeam::None;
+
+	/** Bit per EYomiCharacterKind, see KindBit(). */
+	uint8 KindMask = 0xFF;
+
+	bool bAliveOnly = true;
+
+	/** Usually the querying character itself. */
+	const AActor* IgnoreActor = nullptr;
+
+	static constexpr uint8 KindBit(EYomiCharacterKind Kind) { return static_cast<uint8>(1u << static_cast<uint8>(Kind)); }
+};
+
+/**
+ * World subsystem that tracks every AYomiCharacterBase in a loose uniform grid.
+ * Characters are only re-bucketed once they move further than MoveThreshold from
+ * where they were last filed, and queries pad their cell range by the same amount.
+ * Lock-on, companion scanning and AI aggro query this instead of the physics scene.
+ */
+UCLASS()
+class YOMISURVIVAL_API UYomiCharacterRegistry : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UYomiCharacterRegistry, STATGROUP_Tickables); }
+
+	// ========================================================================
+	// REGISTRATION
+	// ========================================================================
+
+	void RegisterCharacter(AYomiCharacterBase* Character);
+	void UnregisterCharacter(AYomiCharacterBase* Character);
+
+	/** Dead characters stay registered until they leave play so corpses can still be found. */
+	void SetCharacterAlive(AYomiCharacterBase* Character, bool bAlive);
+
+	UFUNCTION(BlueprintPure, Category = "Characters")
+	int32 GetNumRegisteredCharacters() const { return Entries.Num(); }
+
+	/** Players and their companions fight together; everyone else only trusts their own team. */
+	static bool AreAllied(EYomiTeam A, EYomiTeam B);
+
+	// ========================================================================
+	// QUERIES
+	// ========================================================================
+
+	/** All matching characters within Radius of Origin. */
+	void GatherInRadius(const FVector& Origin, float Radius, const FYomiCharacterFilter& Filter, TArray<AYomiCharacterBase*>& OutCharacters) const;
+
+	/** All matching characters within Radius inside a cone of HalfAngleDegrees around Direction. */
+	void GatherInCone(const FVector& Origin, const FVector& Direction, float Radius, float HalfAngleDegrees,
+		const FYomiCharacterFilter& Filter, TArray<AYomiCharacterBase*>& OutCharacters) const;
+
+	/** Up to Count matching characters within Radius, nearest first. */
+	void FindNearest(const FVector& Origin, float Radius, int32 Count, const FYomiCharacterFilter& Filter, TArray<AYomiCharacterBase*>& OutCharacters) const;
+
+	AYomiCharacterBase* FindNearestCharacter(const FVector& Origin, float Radius, const FYomiCharacterFilter& Filter) const;
+
+private:
+	struct FEntry
+	{
+		TWeakObjectPtr<AYomiCharacterBase> Character;
+
+		/** Stays valid after the character is gone, so stale entries can still be unmapped. */
+		TObjectKey<AYomiCharacterBase> Key;
+
+		/** Location the character was filed under; may lag by up to MoveThreshold. */
+		FVector FiledLocation = FVector::ZeroVector;
+		FIntVector Cell = FIntVector::ZeroValue;
+
+		EYomiTeam Team = EYomiTeam::None;
+		uint8 KindBit = 0;
+		bool bAlive = true;
+	};
+
+	/** Edge length of a grid cell. Roughly one lock-on or aggro radius. */
+	static constexpr float CellSize = 1000.0f;
+
+	/** Movement before a character is re-bucketed. */
+	static constexpr float MoveThreshold = 150.0f;
+
+	FIntVector GetCellCoord(const FVector& Location) const;
+
+	bool PassesFilter(const FEntry& Entry, const FYomiCharacterFilter& Filter) const;
+
+	/** Visit every matching character within Radius with its current squared distance. */
+	template<typename FunctorType>
+	void ForEachInRadius(const FVector& Origin, float Radius, const FYomiCharacterFilter& Filter, FunctorType&& Visit) const;
+
+	void AddToCell(int32 EntryIndex);
+	void RemoveFromCell(int32 EntryIndex);
+	void RemoveEntryAt(int32 EntryIndex);
+
+	/** Dense entry storage, iterated each tick to detect moves. */
+	TArray<FEntry> Entries;
+
+	TMap<TObjectKey<AYomiCharacterBase>, int32> EntryIndices;
+	TMap<FIntVector, TArray<int32>> Cells;
+};
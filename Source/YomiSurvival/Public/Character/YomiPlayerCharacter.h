@@ -30,18 +30,20 @@ class YOMISURVIVAL_API AYomiPlayerCharacter : public AYomiCharacterBase
 public:
 	AYomiPlayerCharacter();
 
+	virtual EYomiCharacterKind GetCharacterKind() const override { return EYomiCharacterKind::Player; }
+
 	// ========================================================================
 	// KI (SPIRIT ENERGY) SYSTEM
 	// ========================================================================
 
 	UFUNCTION(BlueprintPure, Category = "Ki")
-	float GetCurrentKi() const { return CurrentKi; }
+	float GetCurrentKi() const;
 
 	UFUNCTION(BlueprintPure, Category = "Ki")
 	float GetMaxKi() const { return MaxKi; }
 
 	UFUNCTION(BlueprintPure, Category = "Ki")
-	float GetKiPercent() const { return MaxKi > 0.0f ? CurrentKi / MaxKi : 0.0f; }
+	float GetKiPercent() const { return MaxKi > 0.0f ? GetCurrentKi() / MaxKi : 0.0f; }
 
 	UFUNCTION(BlueprintCallable, Category = "Ki")
 	bool ConsumeKi(float Amount);
@@ -49,6 +51,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Ki")
 	void RestoreKi(float Amount);
 
+	/**
+	 * Dodge towards Direction, or forward when it is zero. Tolerance lets a dodge replayed
+	 * by the server start that much before the cooldown ends. Called by the combat component.
+	 */
+	bool PerformDodgeRoll(const FVector& Direction, float Tolerance = 0.0f);
+
 	// ========================================================================
 	// HONOR SYSTEM
 	// ========================================================================
@@ -75,6 +83,7 @@ public:
 	// FOOD BUFF SYSTEM
 	// ========================================================================
 
+	/** Restores at once from FoodData; a lasting buff takes its bonuses from the food database entry for its FoodType. */
 	UFUNCTION(BlueprintCallable, Category = "Food")
 	bool ConsumeFood(const FFoodData& FoodData);
 
@@ -84,6 +93,16 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Food")
 	int32 MaxFoodBuffSlots = 3;
 
+	// ========================================================================
+	// BLESSINGS
+	// ========================================================================
+
+	/** Take on a shrine blessing for Duration seconds, replacing any blessing already held. */
+	void ReceiveBlessing(const FYomiModifierLayer& Blessing, float Duration);
+
+	UFUNCTION(BlueprintPure, Category = "Blessing")
+	bool IsBlessed() const;
+
 	// ========================================================================
 	// MEDITATION SYSTEM
 	// ========================================================================
@@ -169,6 +188,7 @@ public:
 	// DELEGATES
 	// ========================================================================
 
+	/** Coalesced like OnHealthChanged. */
 	UPROPERTY(BlueprintAssignable, Category = "Events")
 	FOnKiChanged OnKiChanged;
 
@@ -181,9 +201,17 @@ public:
 protected:
 	virtual void BeginPlay() override;
 	virtual void Tick(float DeltaTime) override;
+	virtual bool NeedsTick() const override { return true; }
 	virtual void SetupPlayerInputComponent(UInputComponent* PlayerInputComponent) override;
 	virtual void Die() override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void OnRep_StaminaStat() override;
+	virtual void FlushStatNotifications() override;
+	virtual void UpdateRegenRates() override;
+	virtual float CalculateHealthRegen() const override;
+	virtual float CalculateStaminaRegen() const override;
+	virtual void InitializeAttributes() override;
+	virtual void ApplyAttribute(EYomiAttribute Attribute, float Value) override;
 
 	// ========================================================================
 	// INPUT ACTIONS
@@ -263,8 +291,8 @@ protected:
 
 private:
 	// Ki System
-	UPROPERTY(EditAnywhere, Category = "Ki", Replicated)
-	float CurrentKi = 50.0f;
+	UPROPERTY(ReplicatedUsing = OnRep_KiStat)
+	FYomiRegenStat KiStat;
 
 	UPROPERTY(EditAnywhere, Category = "Ki", Replicated)
 	float MaxKi = 50.0f;
@@ -275,7 +303,16 @@ private:
 	UPROPERTY(EditAnywhere, Category = "Ki")
 	float MeditationKiRegenMultiplier = 5.0f;
 
+	FYomiStatNotifier KiNotifier;
+
+	/** Queue a notification and mark KiStat for replication after writing it. */
+	void MarkKiDirty();
+
+	UFUNCTION()
+	void OnRep_KiStat();
+
 	// Honor System
+	/** Only the owner sees the points; everyone sees the rank. */
 	UPROPERTY(EditAnywhere, Category = "Honor", Replicated)
 	float HonorPoints = 0.0f;
 
@@ -287,23 +324,36 @@ private:
 	// Food Buffs
 	struct FActiveFoodBuff
 	{
-		FFoodData FoodData;
-		float RemainingDuration;
+		/** Handle into the data subsystem's food database. */
+		EFoodType Food = EFoodType::None;
+		float ExpiryTime = 0.0f;
 	};
+
+	/** Ordered by expiry, soonest last, so expiring is a pop off the back. */
 	TArray<FActiveFoodBuff> ActiveFoodBuffs;
-	void TickFoodBuffs(float DeltaTime);
+
+	/** Per-second regen from every active buff, folded into the regeneration rates. */
+	float FoodHealthRegen = 0.0f;
+	float FoodStaminaRegen = 0.0f;
+
+	/** Drop the buffs that have run out; only ever looks at the soonest. */
+	void TickFoodBuffs();
+
+	/** Fold every active buff into the food modifier layer and the regen rates. */
 	void RecalculateFoodBonuses();
 
-	float FoodHealthBonus = 0.0f;
-	float FoodStaminaBonus = 0.0f;
-	float FoodDamageBonus = 0.0f;
-	float FoodDefenseBonus = 0.0f;
+	// Blessings
+	FTimerHandle BlessingTimerHandle;
+	void EndBlessing();
 
 	// Meditation
 	bool bIsMeditating = false;
 
 	// Sprint
 	bool bIsSprinting = false;
+
+	/** Sprinting and moving, so stamina is draining at SprintStaminaCost. */
+	bool bSprintDraining = false;
 	UPROPERTY(EditAnywhere, Category = "Movement")
 	float SprintSpeedMultiplier = 1.5f;
 	UPROPERTY(EditAnywhere, Category = "Movement")
@@ -0,0 +1,64 @@
+// Copyright (c) 2026 Yomi Survival. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Combat/YomiBallistics.h"
+#include "YomiAimSubsystem.generated.h"
+
+/**
+ * World subsystem that keeps a leading aim solution for every shooter tracking a target.
+ * Shooters register once when they pick a target; each frame all of them are solved
+ * together with YomiBallistics::SolveInterceptBatch, and attacks read the latest result.
+ * One-off aims (player aim assist) should call YomiBallistics::SolveIntercept directly.
+ */
+UCLASS()
+class YOMISURVIVAL_API UYomiAimSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UYomiAimSubsystem, STATGROUP_Tickables); }
+
+	/**
+	 * Start or update Shooter's aim at Target for projectiles launched at Speed with GravityScale.
+	 * MuzzleOffset is in the shooter's local space.
+	 */
+	void TrackTarget(AActor* Shooter, AActor* Target, float Speed, float GravityScale, const FVector& MuzzleOffset = FVector::ZeroVector);
+
+	void StopTracking(const AActor* Shooter);
+
+	/** The launch direction from this frame's solve. False if Shooter is not tracking or cannot reach its target. */
+	bool GetAimSolution(const AActor* Shooter, FVector& OutDirection, float& OutTimeOfFlight) const;
+
+	/** Where Shooter launches from. */
+	FVector GetMuzzleLocation(const AActor* Shooter) const;
+
+	UFUNCTION(BlueprintPure, Category = "Combat")
+	int32 GetNumTrackedShooters() const { return Shooters.Num(); }
+
+private:
+	int32 FindShooter(const AActor* Shooter) const;
+	void RemoveShooterAt(int32 Index);
+
+	// Struct-of-arrays shooter state, all arrays share the same index
+	TArray<TWeakObjectPtr<AActor>> Shooters;
+
+	/** Stays valid after the shooter is gone, so stale entries can still be unmapped. */
+	TArray<TObjectKey<AActor>> ShooterKeys;
+
+	TArray<TWeakObjectPtr<AActor>> Targets;
+	TArray<float> Speeds;
+	TArray<float> GravityScales;
+	TArray<FVector> MuzzleOffsets;
+	TArray<FVector> Directions;
+	TArray<float> FlightTimes;
+
+	TMap<TObjectKey<AActor>, int32> ShooterIndices;
+
+	/** Rebuilt every frame from the live shooters. */
+	YomiBallistics::FInterceptBatch Batch;
+};
@@ -0,0 +1,115 @@
+// Copyright (c) 2026 Yomi Survival. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Ballistic intercept math for leading moving targets with gravity-affected projectiles.
+ * A projectile leaving at a fixed speed under constant gravity is aimed at where the
+ * target will be when it arrives, on the low arc. Nothing here touches the world.
+ */
+namespace YomiBallistics
+{
+	/** Refinement passes on the flight time; each one re-aims at where the target will be by then. */
+	constexpr int32 InterceptIterations = 3;
+
+	/**
+	 * Flight time of the low arc that reaches Offset from the origin when launched at Speed
+	 * under GravityZ, or a negative value when Offset is out of range.
+	 */
+	inline float LowArcTime(const FVector& Offset, float Speed, float GravityZ)
+	{
+		// |Offset - G t^2 / 2| = Speed t, a quadratic in t^2
+		const float A = 0.25f * GravityZ * GravityZ;
+		const float B = -(Offset.Z * GravityZ + Speed * Speed);
+		const float C = Offset.SizeSquared();
+
+		float TimeSq;
+		if (A < KINDA_SMALL_NUMBER)
+		{
+			if (B >= 0.0f) return -1.0f;
+			TimeSq = -C / B;
+		}
+		else
+		{
+			const float Discriminant = B * B - 4.0f * A * C;
+			if (Discriminant < 0.0f) return -1.0f;
+			TimeSq = (-B - FMath::Sqrt(Discriminant)) / (2.0f * A);
+		}
+
+		return TimeSq > 0.0f ? FMath::Sqrt(TimeSq) : -1.0f;
+	}
+
+	/**
+	 * Launch direction that hits a target at TargetOffset from the muzzle moving at TargetVelocity.
+	 * Returns false when no arc at Speed reaches it.
+	 */
+	inline bool SolveIntercept(const FVector& TargetOffset, const FVector& TargetVelocity, float Speed, float GravityZ,
+		FVector& OutDirection, float& OutTimeOfFlight)
+	{
+		if (Speed <= 0.0f) return false;
+
+		FVector Aim = TargetOffset;
+		float Time = TargetOffset.Size() / Speed;
+
+		for (int32 Iteration = 0; Iteration < InterceptIterations; ++Iteration)
+		{
+			Aim = TargetOffset + TargetVelocity * Time;
+			Time = LowArcTime(Aim, Speed, GravityZ);
+			if (Time <= 0.0f) return false;
+		}
+
+		const FVector Velocity(Aim.X / Time, Aim.Y / Time, Aim.Z / Time - 0.5f * GravityZ * Time);
+		OutDirection = Velocity.GetSafeNormal();
+		OutTimeOfFlight = Time;
+		return true;
+	}
+
+	/**
+	 * Many intercept problems laid out component by component, so four shooters are solved
+	 * per vector instruction. Fill the inputs with Add, call SolveInterceptBatch, then read
+	 * the outputs at the index Add returned. Unsolvable entries get a negative TimeOfFlight.
+	 */
+	struct FInterceptBatch
+	{
+		// Inputs
+		TArray<float> OffsetX, OffsetY, OffsetZ;
+		TArray<float> VelocityX, VelocityY, VelocityZ;
+		TArray<float> Speed;
+		TArray<float> GravityZ;
+
+		// Outputs
+		TArray<float> DirectionX, DirectionY, DirectionZ;
+		TArray<float> TimeOfFlight;
+
+		int32 Num() const { return Speed.Num(); }
+
+		int32 Add(const FVector& TargetOffset, const FVector& TargetVelocity, float InSpeed, float InGravityZ)
+		{
+			OffsetX.Add(TargetOffset.X);
+			OffsetY.Add(TargetOffset.Y);
+			OffsetZ.Add(TargetOffset.Z);
+			VelocityX.Add(TargetVelocity.X);
+			VelocityY.Add(TargetVelocity.Y);
+			VelocityZ.Add(TargetVelocity.Z);
+			GravityZ.Add(InGravityZ);
+			return Speed.Add(InSpeed);
+		}
+
+		FVector GetDirection(int32 Index) const { return FVector(DirectionX[Index], DirectionY[Index], DirectionZ[Index]); }
+
+		void Reset()
+		{
+			OffsetX.Reset(); OffsetY.Reset(); OffsetZ.Reset();
+			VelocityX.Reset(); VelocityY.Reset(); VelocityZ.Reset();
+			Speed.Reset();
+			GravityZ.Reset();
+			DirectionX.Reset(); DirectionY.Reset(); DirectionZ.Reset();
+			TimeOfFlight.Reset();
+		}
+	};
+
+	/** Solve every entry in Batch: four at a time in vector registers, the remainder with SolveIntercept. */
+	YOMISURVIVAL_API void SolveInterceptBatch(FInterceptBatch& Batch);
+}
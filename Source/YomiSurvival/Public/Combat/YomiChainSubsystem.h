@@ -0,0 +1,153 @@
+// Copyright (c) 2026 Yomi Survival. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "YomiChainSubsystem.generated.h"
+
+class AYomiChainWeapon;
+class UInstancedStaticMeshComponent;
+
+/**
+ * World subsystem that simulates every thrown chain (kusarigama, kyoketsu-shoge).
+ * Each chain is a fixed block of Verlet particles in one flat array: the first is pinned
+ * to the wielder's hand, the last is the weighted head. Every frame all chains are
+ * integrated, their link lengths are enforced in SolverIterations passes, the links are
+ * swept for hits and written to the owning weapon's instanced link mesh.
+ * Only thrown chains exist; a chain is released as soon as it is reeled back in.
+ */
+UCLASS(Config = Game)
+class YOMISURVIVAL_API UYomiChainSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Particles per chain block, so at most one fewer links. */
+	static constexpr int32 MaxParticles = 24;
+
+	/** Link length a fully reeled chain shrinks to. */
+	static constexpr float MinLinkLength = 2.0f;
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UYomiChainSubsystem, STATGROUP_Tickables); }
+
+	/**
+	 * Start a chain of NumLinks collapsed at the owner's anchor. Links grow to LinkLength at
+	 * PayOutRate per second each. Returns the chain slot, or INDEX_NONE.
+	 */
+	int32 AcquireChain(AYomiChainWeapon* Owner, int32 NumLinks, float LinkLength, float PayOutRate, UInstancedStaticMeshComponent* LinkInstances);
+	void ReleaseChain(int32 Slot);
+
+	/** Give the head Velocity at the next step. */
+	void LaunchHead(int32 Slot, const FVector& Velocity);
+
+	/** Pin the head to Parent (a bone when Bone is set) at WorldLocation, for wraps and grapples. */
+	void AttachHead(int32 Slot, USceneComponent* Parent, FName Bone, const FVector& WorldLocation);
+	void DetachHead(int32 Slot);
+
+	/** Shorten every link to MinLinkLength at Rate per second; the owner is told when it is back. */
+	void ReelIn(int32 Slot, float Rate);
+
+	/** Which hits the chain reports: the head always stops on the world, pawns are swept only when asked. */
+	void SetSweep(int32 Slot, bool bSweepPawns, bool bLinksSweep, float LinkRadius, float HeadRadius);
+
+	FVector GetHeadLocation(int32 Slot) const;
+	TConstArrayView<FVector> GetParticles(int32 Slot) const;
+
+	UFUNCTION(BlueprintPure, Category = "Combat")
+	int32 GetNumActiveChains() const { return Chains.Num() - FreeSlots.Num(); }
+
+private:
+	struct FChain
+	{
+		TWeakObjectPtr<AYomiChainWeapon> Owner;
+		TWeakObjectPtr<UInstancedStaticMeshComponent> Instances;
+
+		int32 NumParticles = 0;
+		float LinkLength = MinLinkLength;
+		float TargetLinkLength = MinLinkLength;
+		float ReelRate = 0.0f;
+		bool bReelingIn = false;
+
+		FVector PendingHeadVelocity = FVector::ZeroVector;
+		bool bHasPendingLaunch = false;
+
+		TWeakObjectPtr<USceneComponent> HeadParent;
+		FName HeadBone;
+		FTransform HeadOffset = FTransform::Identity;
+		bool bHeadAttached = false;
+
+		bool bSweepPawns = false;
+		bool bLinksSweep = false;
+		float LinkRadius = 4.0f;
+		float HeadRadius = 10.0f;
+
+		bool bActive = false;
+	};
+
+	struct FChainHit
+	{
+		int32 Slot = INDEX_NONE;
+
+		/** The chain's owner when the hit was found, so a slot reused mid-dispatch is not told about it. */
+		AYomiChainWeapon* Owner = nullptr;
+
+		/** The link that hit, or the last link for the head. */
+		FVector LinkStart = FVector::ZeroVector;
+		FVector LinkEnd = FVector::ZeroVector;
+
+		bool bHead = false;
+		FHitResult Hit;
+	};
+
+	static int32 BlockStart(int32 Slot) { return Slot * MaxParticles; }
+
+	bool IsActiveChain(int32 Slot) const { return Chains.IsValidIndex(Slot) && Chains[Slot].bActive; }
+
+	/** Verlet step for every particle of one chain, then pin both ends. */
+	void Integrate(int32 Slot, float DeltaTime, float GravityZ);
+
+	/** Enforce link lengths in SolverIterations passes over the chain's block. */
+	void SolveConstraints(int32 Slot);
+
+	/** Sweep the head and links from last frame's positions, into Hits. */
+	void SweepChain(int32 Slot);
+
+	void UpdateVisuals(int32 Slot);
+
+	bool ShouldRenderVisuals() const;
+
+	/** Constraint passes per frame; more keeps long chains stiffer. */
+	UPROPERTY(Config)
+	int32 SolverIterations = 8;
+
+	/** The head's share of a constraint correction relative to a link; lower is a heavier weight. */
+	UPROPERTY(Config)
+	float HeadInverseMass = 0.25f;
+
+	/** Fraction of velocity kept each step. */
+	UPROPERTY(Config)
+	float Damping = 0.98f;
+
+	/** Longest step simulated at once, for stability after hitches. */
+	UPROPERTY(Config)
+	float MaxStepTime = 1.0f / 30.0f;
+
+	/** MaxParticles per slot, slot after slot. */
+	TArray<FVector> Positions;
+	TArray<FVector> PreviousPositions;
+
+	TArray<FChain> Chains;
+	TArray<int32> FreeSlots;
+
+	/** Hits found this frame, handed to the owners once every chain has been stepped. */
+	TArray<FChainHit> Hits;
+
+	/** Chains that finished reeling in this frame. */
+	TArray<int32> RetractedSlots;
+
+	/** Scratch for link instance transforms. */
+	TArray<FTransform> InstanceTransforms;
+};
@@ -0,0 +1,135 @@
+// Copyright (c) 2026 Yomi Survival. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Combat/YomiWeaponBase.h"
+#include "YomiChainWeapon.generated.h"
+
+class UInstancedStaticMeshComponent;
+class UYomiChainSubsystem;
+
+/**
+ * Weapon class for thrown chains: kusarigama and kyoketsu-shoge.
+ * Attacks throw the weighted head out along the aim; the chain itself is simulated by
+ * UYomiChainSubsystem, which sweeps it and reports back what it touched.
+ *
+ * Light attacks strike with the head and links, heavy attacks wrap the first foe the head
+ * reaches, and specials pull a struck foe in or, against a wall, pull the wielder to it.
+ * The weapon never ticks.
+ */
+UCLASS()
+class YOMISURVIVAL_API AYomiChainWeapon : public AYomiWeaponBase
+{
+	GENERATED_BODY()
+
+public:
+	AYomiChainWeapon();
+
+	virtual void StartLightAttack() override;
+	virtual void StartHeavyAttack() override;
+	virtual void StartSpecialAttack() override;
+	virtual void OnUnequipped() override;
+
+	UFUNCTION(BlueprintPure, Category = "Chain")
+	bool IsChainOut() const { return ChainSlot != INDEX_NONE; }
+
+	/** Every attack throws the chain, so none can start until it is back in the hand. */
+	virtual bool CanStartAttack() const override { return !IsChainOut() && Super::CanStartAttack(); }
+
+	/** Where the chain leaves the wielder's hand. */
+	FVector GetChainAnchor() const;
+
+	/** The thrown chain touched something; LinkStart and LinkEnd are the link that did. */
+	void HandleChainHit(const FHitResult& Hit, const FVector& LinkStart, const FVector& LinkEnd, bool bHead);
+
+	/** The chain is back in the hand. */
+	void HandleChainRetracted();
+
+	/** The head, or one of the thinner links. */
+	virtual uint8 GetLastHitPart() const override { return bLastHitHead ? HitPartHead : HitPartLink; }
+	virtual float GetHitValidationRadius(uint8 HitPart) const override { return HitPart == HitPartHead ? HeadRadius : LinkRadius; }
+
+protected:
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** Reports the link that hit, not the handle, so the server checks the right segment. */
+	virtual void GetBladeSegment(FVector& OutBase, FVector& OutTip) const override;
+
+	/** Adds the wrap and pull on top of the usual damage. Server only. */
+	virtual void ApplySwingHit(AActor* OtherActor, const FHitResult& HitResult) override;
+
+	/** One instance per link, placed in world space by the chain subsystem. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+	TObjectPtr<UInstancedStaticMeshComponent> ChainLinks;
+
+	UPROPERTY(EditAnywhere, Category = "Chain")
+	FName ChainAnchorSocket = TEXT("chain_anchor");
+
+	/** Links between the hand and the head; the chain's full length is the weapon's range. */
+	UPROPERTY(EditAnywhere, Category = "Chain", meta = (ClampMin = "1", ClampMax = "23"))
+	int32 NumLinks = 12;
+
+	UPROPERTY(EditAnywhere, Category = "Chain")
+	float ThrowSpeed = 2500.0f;
+
+	/** The head reels back in after this long if it has not hit anything. */
+	UPROPERTY(EditAnywhere, Category = "Chain")
+	float ThrowDuration = 0.5f;
+
+	/** Chain length taken back per second. */
+	UPROPERTY(EditAnywhere, Category = "Chain")
+	float ReelSpeed = 1500.0f;
+
+	UPROPERTY(EditAnywhere, Category = "Chain")
+	float HeadRadius = 10.0f;
+
+	UPROPERTY(EditAnywhere, Category = "Chain")
+	float LinkRadius = 4.0f;
+
+	/** Applied to a wrapped foe, and how long the head stays wound around it. */
+	UPROPERTY(EditAnywhere, Category = "Chain|Wrap")
+	FYomiStatusInfliction WrapStatus;
+
+	UPROPERTY(EditAnywhere, Category = "Chain|Pull")
+	float PullSpeed = 1200.0f;
+
+	UPROPERTY(EditAnywhere, Category = "Chain|Pull")
+	float PullLift = 250.0f;
+
+	UPROPERTY(EditAnywhere, Category = "Chain|Pull")
+	float GrappleLaunchSpeed = 1800.0f;
+
+private:
+	static constexpr uint8 HitPartLink = 0;
+	static constexpr uint8 HitPartHead = 1;
+
+	enum class EChainMode : uint8
+	{
+		Strike,
+		Wrap,
+		Pull,
+	};
+
+	void ThrowChain(EChainMode Mode);
+
+	/** Stop sweeping and take the chain back in. */
+	void BeginReel();
+
+	/** Drop the chain at once, wherever it is. */
+	void ReleaseChain();
+
+	UYomiChainSubsystem* GetChainSubsystem() const;
+
+	int32 ChainSlot = INDEX_NONE;
+	EChainMode ChainMode = EChainMode::Strike;
+
+	/** The head is hooked into the world and the wielder is being pulled to it. */
+	bool bGrappling = false;
+
+	FVector LastHitLinkStart = FVector::ZeroVector;
+	FVector LastHitLinkEnd = FVector::ZeroVector;
+	bool bLastHitHead = false;
+
+	FTimerHandle ReelTimerHandle;
+};
@@ -5,14 +5,79 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Core/YomiGameTypes.h"
+#include "Engine/NetSerialization.h"
+#include "Combat/YomiCombatRules.h"
 #include "YomiCombatComponent.generated.h"
 
 class AYomiWeaponBase;
 class AYomiPlayerCharacter;
+class AYomiCharacterBase;
+
+/**
+ * Predicted actions a client started in one frame, bit-packed for the server.
+ * Keys are consecutive from FirstKey so only the first one is sent; directions
+ * travel as a quantised yaw. A single light attack costs two bytes.
+ */
+USTRUCT()
+struct FYomiActionFrame
+{
+	GENERATED_BODY()
+
+	static constexpr int32 MaxActions = 4;
+	static constexpr uint32 KeyRange = 1 << 10;
+
+	uint16 FirstKey = 0;
+	uint8 NumActions = 0;
+	EYomiPredictedAction Actions[MaxActions] = {};
+	uint8 Yaws[MaxActions] = {};
+
+	/** Bit per action, set when it carries a direction. */
+	uint8 DirectionMask = 0;
+
+	bool IsEmpty() const { return NumActions == 0; }
+	bool IsFull() const { return NumActions >= MaxActions; }
+
+	void Add(EYomiPredictedAction Action, const FVector& Direction);
+	FVector GetDirection(int32 Index) const;
+
+	/** Direction as the server will see it, so both sides act on the same value. */
+	static FVector QuantizeDirection(const FVector& Direction);
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FYomiActionFrame> : public TStructOpsTypeTraitsBase2<FYomiActionFrame>
+{
+	enum { WithNetSerializer = true };
+};
+
+/** The server's verdict on one FYomiActionFrame: a bit per action, set when it was rejected. */
+USTRUCT()
+struct FYomiActionAck
+{
+	GENERATED_BODY()
+
+	uint16 FirstKey = 0;
+	uint8 NumActions = 0;
+	uint8 RejectedMask = 0;
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FYomiActionAck> : public TStructOpsTypeTraitsBase2<FYomiActionAck>
+{
+	enum { WithNetSerializer = true };
+};
 
 /**
  * Combat component handling weapon management, attack execution,
  * blocking, parrying, and the Ki-powered special ability system.
+ *
+ * Attacks, dodges and Ki abilities are predicted on the owning client: they start and
+ * spend their costs at once under a prediction key, and the server replays them with the
+ * same checks. Rejected actions have their stamina and Ki refunded and their attack cut short.
  */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class YOMISURVIVAL_API UYomiCombatComponent : public UActorComponent
@@ -26,9 +91,18 @@ public:
 	// WEAPON MANAGEMENT
 	// ========================================================================
 
+	/** Equip an existing weapon. Server only; clients follow through the replicated EquippedWeapon. */
 	UFUNCTION(BlueprintCallable, Category = "Combat")
 	bool EquipWeapon(AYomiWeaponBase* Weapon);
 
+	/**
+	 * Spawn the weapon for WeaponType and equip it. The actor class follows the weapon's class,
+	 * so chain weapons get their thrown chain. Weapons spawned here are destroyed when unequipped. Server only.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Combat")
+	AYomiWeaponBase* EquipWeaponOfType(EWeaponType WeaponType);
+
+	/** Server only. */
 	UFUNCTION(BlueprintCallable, Category = "Combat")
 	void UnequipWeapon();
 
@@ -54,6 +128,38 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Combat")
 	bool IsAttacking() const { return bIsAttacking; }
 
+	/**
+	 * Start Action now. On a remote client it runs as a prediction the server confirms or rejects.
+	 * Direction is only used by dodges and dashes. Returns false if the action could not start.
+	 */
+	bool PerformAction(EYomiPredictedAction Action, const FVector& Direction = FVector::ZeroVector);
+
+	/** Stamina spent by predictions the server has not answered yet. */
+	float GetUnconfirmedStaminaSpend() const;
+
+	/** Ki spent by predictions the server has not answered yet. */
+	float GetUnconfirmedKiSpend() const;
+
+	/**
+	 * Send a hit the owning client saw to the server. Any attack still waiting in the outgoing
+	 * action frame goes first, so the server has opened the swing's damage window by the time the hit arrives.
+	 */
+	void ReportMeleeHit(AYomiCharacterBase* Target, const FVector& BladeBase, const FVector& BladeTip, uint8 HitPart, float ClientTime);
+
+	/**
+	 * A hit seen by the owning client, with the blade pose, the weapon part that struck and the server time
+	 * the client was viewing. Validated against the target's rewound hitbox before any damage is applied.
+	 */
+	UFUNCTION(Server, Reliable)
+	void ServerReportMeleeHit(AYomiCharacterBase* Target, FVector_NetQuantize BladeBase, FVector_NetQuantize BladeTip, uint8 HitPart, float ClientTime);
+
+	/** Replay a client's predicted actions and answer with ClientAcknowledgeActions. */
+	UFUNCTION(Server, Reliable)
+	void ServerExecuteActions(const FYomiActionFrame& Frame);
+
+	UFUNCTION(Client, Reliable)
+	void ClientAcknowledgeActions(const FYomiActionAck& Ack);
+
 	// ========================================================================
 	// BLOCKING & PARRYING
 	// ========================================================================
@@ -87,6 +193,10 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Combat")
 	bool IsLockedOn() const { return LockedTarget != nullptr; }
 
+	/** The owning client's lock-on, mirrored on the server so server-side aim assist leads the same target. */
+	UFUNCTION(Server, Reliable)
+	void ServerSetLockedTarget(AActor* NewTarget);
+
 	// ========================================================================
 	// KI ABILITIES
 	// ========================================================================
@@ -122,12 +232,31 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** Only enabled while locked on, to rotate towards the target. */
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
 private:
-	UPROPERTY()
+	/** Spawned and equipped on the server; clients equip it locally when it replicates. */
+	UPROPERTY(ReplicatedUsing = OnRep_EquippedWeapon)
 	TObjectPtr<AYomiWeaponBase> EquippedWeapon;
 
+	UFUNCTION()
+	void OnRep_EquippedWeapon(AYomiWeaponBase* PreviousWeapon);
+
+	/** EquippedWeapon was spawned by EquipWeaponOfType and goes away with it. */
+	bool bSpawnedEquippedWeapon = false;
+
+	/** Actor class spawned for each weapon class; the rest use DefaultWeaponClass. */
+	UPROPERTY(EditAnywhere, Category = "Combat")
+	TMap<EWeaponClass, TSubclassOf<AYomiWeaponBase>> WeaponActorClasses;
+
+	UPROPERTY(EditAnywhere, Category = "Combat")
+	TSubclassOf<AYomiWeaponBase> DefaultWeaponClass;
+
 	UPROPERTY()
 	TObjectPtr<AYomiPlayerCharacter> OwnerPlayer;
 
@@ -136,16 +265,23 @@ private:
 
 	// Attack state
 	bool bIsAttacking = false;
-	float AttackCooldownTimer = 0.0f;
+	FTimerHandle AttackTimerHandle;
+
+	/** Prediction key of the current attack on the owning client, or INDEX_NONE if it was not predicted. */
+	int32 ActiveAttackKey = INDEX_NONE;
 
 	// Blocking
 	bool bIsBlocking = false;
 	bool bInParryWindow = false;
-	float ParryWindowDuration = 0.2f;
-	float ParryTimer = 0.0f;
+	float ParryWindowDuration = YomiCombatRules::ParryWindowDuration;
+	FTimerHandle ParryTimerHandle;
 
 	UPROPERTY(EditAnywhere, Category = "Combat")
-	float BlockStaminaCostPerHit = 15.0f;
+	float BlockStaminaCostPerHit = YomiCombatRules::BlockStaminaCostPerHit;
+
+	/** Reported blades further than this from the attacker are rejected outright. */
+	UPROPERTY(EditAnywhere, Category = "Combat")
+	float MaxReportedHitDistance = 500.0f;
 
 	// Ki costs
 	UPROPERTY(EditAnywhere, Category = "Combat|Ki")
@@ -161,8 +297,75 @@ private:
 	UPROPERTY(EditAnywhere, Category = "Combat")
 	float LockOnRange = 1500.0f;
 
+	/** Extra range the server allows on a client's lock-on, since it sees both actors a little later. */
+	UPROPERTY(EditAnywhere, Category = "Combat")
+	float LockOnRangeTolerance = 300.0f;
+
+	// Prediction
+	struct FPendingAction
+	{
+		uint16 Key = 0;
+		EYomiPredictedAction Action = EYomiPredictedAction::None;
+		float StaminaSpent = 0.0f;
+		float KiSpent = 0.0f;
+	};
+
+	/** Oldest first. */
+	TArray<FPendingAction> PendingActions;
+
+	/** Actions started this frame, sent together on the next tick. */
+	FYomiActionFrame OutgoingFrame;
+	FTimerHandle SendFrameTimerHandle;
+	uint16 NextPredictionKey = 0;
+
+	/** The client stops predicting once this many actions wait on the server. */
+	UPROPERTY(EditAnywhere, Category = "Combat|Prediction")
+	int32 MaxPendingActions = 16;
+
+	/**
+	 * The server starts a replayed attack or dodge this long before the previous one
+	 * has finished, since it began that one up to half a round trip after the client did.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Combat|Prediction")
+	float ServerActionTolerance = 0.15f;
+
+	/** Run Action's checks and effects. Tolerance is how early an unfinished attack or dodge may be cut off. */
+	bool ExecuteAction(EYomiPredictedAction Action, const FVector& Direction, float Tolerance);
+
+	void SendActionFrame();
+	void RollBackAction(const FPendingAction& Pending);
+
+	/**
+	 * Whether an attack action could start now, checking its costs and the weapon without spending anything.
+	 * bIgnoreCurrentAttack checks as if the attack in progress had already ended.
+	 */
+	bool CanStartAttack(EYomiPredictedAction Action, bool bIgnoreCurrentAttack) const;
+
+	static bool IsAttackAction(EYomiPredictedAction Action);
+
+	bool StartAttack(bool bHeavy);
+	bool StartSpecialAttack();
+	bool StartKiDash(const FVector& Direction);
+	bool StartKiPowerStrike();
+	bool StartKiSpiritArrow();
+
+	/** Horizontal movement input, or facing when there is none. */
+	FVector GetActionDirection() const;
+
 	AActor* FindLockOnTarget() const;
+	void SetLockedTarget(AActor* NewTarget);
+
+	/** Living, visible and not on its way out of the world or back into the actor pool. */
+	bool IsValidLockOnTarget(const AActor* Target) const;
+
+	void HandlePooledActorReleased(AActor* Actor);
 	void UpdateLockOnRotation(float DeltaTime);
 
+	/** Mark an attack in progress and schedule its end. */
+	void BeginAttack(float Duration);
 	void EndAttack();
+
+	/** End the current attack before its timer runs out. */
+	void CancelAttack();
+	void CloseParryWindow();
 };
@@ -0,0 +1,143 @@
+// Copyright (c) 2026 Yomi Survival. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/YomiGameTypes.h"
+
+/**
+ * Pure combat formulas shared by the weapon and combat component actors and the
+ * headless combat simulator, so balance numbers measured offline are the ones players get.
+ * Nothing here touches the world, timers or replication.
+ */
+namespace YomiCombatRules
+{
+	constexpr int32 MaxCombo = 3;
+	constexpr float ComboMultiplierPerHit = 0.15f;
+	constexpr float HeavyAttackMultiplier = 2.0f;
+
+	/** Heavy attacks cost more stamina and take longer than light ones by this factor. */
+	constexpr float HeavyAttackCostScale = 1.5f;
+	constexpr float SpecialAttackDurationScale = 2.0f;
+
+	/** Below this durability fraction a weapon deals reduced damage. */
+	constexpr float LowDurabilityThreshold = 0.2f;
+	constexpr float LowDurabilityDamageScale = 0.5f;
+
+	constexpr float ParryWindowDuration = 0.2f;
+	constexpr float BlockStaminaCostPerHit = 15.0f;
+
+	/** No resistance source may reduce a damage type by more than this. */
+	constexpr float MaxResistance = 0.9f;
+
+	/** Armor defense at which half the damage of its type is absorbed. */
+	constexpr float ArmorDefenseScale = 100.0f;
+
+	/**
+	 * Damage of one weapon hit before the target's resistances. WielderDamageScale is the wielder's
+	 * Damage attribute, which folds in food, blessings and the like (1 with none).
+	 */
+	inline float WeaponDamage(const FWeaponData& Weapon, int32 ComboCount, float DurabilityPercent, bool bIsHeavyAttack, bool bIsStealthAttack,
+		float WielderDamageScale, float ComboMultiplier = ComboMultiplierPerHit, float HeavyMultiplier = HeavyAttackMultiplier)
+	{
+		float Damage = Weapon.BaseDamage * WielderDamageScale;
+
+		if (bIsHeavyAttack)
+		{
+			Damage *= HeavyMultiplier;
+		}
+
+		Damage *= (1.0f + ComboCount * ComboMultiplier);
+
+		if (bIsStealthAttack && Weapon.bHasStealthBonus)
+		{
+			Damage *= Weapon.StealthDamageMultiplier;
+		}
+
+		if (DurabilityPercent < LowDurabilityThreshold)
+		{
+			Damage *= LowDurabilityDamageScale; // Half damage when near broken
+		}
+
+		return Damage;
+	}
+
+	inline int32 NextComboCount(int32 ComboCount, int32 ComboCap = MaxCombo)
+	{
+		return FMath::Min(ComboCount + 1, ComboCap);
+	}
+
+	inline float AttackDuration(const FWeaponData& Weapon, bool bIsHeavyAttack)
+	{
+		const float Duration = 1.0f / FMath::Max(Weapon.AttackSpeed, KINDA_SMALL_NUMBER);
+		return bIsHeavyAttack ? Duration * HeavyAttackCostScale : Duration;
+	}
+
+	inline float AttackStaminaCost(const FWeaponData& Weapon, bool bIsHeavyAttack)
+	{
+		return bIsHeavyAttack ? Weapon.StaminaCost * HeavyAttackCostScale : Weapon.StaminaCost;
+	}
+
+	/** Damage that gets through a block with Weapon. A parry stops everything. */
+	inline float BlockedDamage(float IncomingDamage, const FWeaponData& Weapon, bool bInParryWindow)
+	{
+		if (bInParryWindow) return 0.0f;
+		return IncomingDamage * (1.0f - Weapon.BlockDamageReduction);
+	}
+
+	inline float ResistedDamage(float Amount, float Resistance)
+	{
+		return Amount * (1.0f - Resistance);
+	}
+
+	inline float ClampResistance(float Resistance)
+	{
+		return FMath::Clamp(Resistance, 0.0f, MaxResistance);
+	}
+
+	/** Launch speed (cm/s) per point of FWeaponData::KnockbackForce. */
+	constexpr float KnockbackLaunchScale = 4.0f;
+
+	/**
+	 * Heavy and special swings of staves and polearms hit every foe in a horizontal arc
+	 * of the weapon's range. Other classes return an attack with no shape.
+	 */
+	inline FYomiAreaAttack DefaultSweepAttack(const FWeaponData& Weapon)
+	{
+		FYomiAreaAttack Attack;
+		Attack.Radius = Weapon.Range;
+		Attack.KnockbackForce = Weapon.KnockbackForce * KnockbackLaunchScale;
+		Attack.KnockbackUpward = Weapon.KnockbackForce;
+
+		switch (Weapon.WeaponClass)
+		{
+		case EWeaponClass::Staff:
+			Attack.Shape = EYomiAreaShape::Arc;
+			Attack.HalfAngleDegrees = 150.0f;
+			break;
+		case EWeaponClass::Polearm:
+			Attack.Shape = EYomiAreaShape::Arc;
+			Attack.HalfAngleDegrees = 75.0f;
+			break;
+		default:
+			break;
+		}
+
+		return Attack;
+	}
+
+	/** Diminishing returns: ArmorDefenseScale points absorb half the damage, twice that two thirds. */
+	inline float DefenseToResistance(float Defense)
+	{
+		return Defense > 0.0f ? ClampResistance(Defense / (Defense + ArmorDefenseScale)) : 0.0f;
+	}
+
+	/**
+	 * Flat defense for a food or blessing bonus given as a fraction (0.05 for +5%). It is added to armor
+	 * rather than scaling it, so an unarmored character gains roughly that much resistance too.
+	 */
+	inline float DefenseBonusToDefense(float Bonus)
+	{
+		return Bonus * ArmorDefenseScale;
+	}
+}
@@ -0,0 +1,29 @@
+// Copyright (c) 2026 Yomi Survival. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "YomiCombatSimCommandlet.generated.h"
+
+/**
+ * Headless combat balance benchmark.
+ * Simulates duels between every weapon in UYomiDataSubsystem and every native enemy class,
+ * for each armor tier, using the shared YomiCombatRules formulas with fixed time steps and
+ * seeded random streams, so results are identical between runs and machines.
+ * Matchups run in parallel across all cores. Prints time-to-kill tables and throughput.
+ *
+ * Usage: UnrealEditor-Cmd YomiSurvival.uproject -run=YomiCombatSim -nullrhi
+ *        [-Duels=1000] [-Seed=1337] [-TimeStep=0.0166] [-MaxDuelTime=180]
+ *        [-DefendChance=0.5] [-ParryChance=0.25] [-Csv=Saved/CombatSim.csv]
+ */
+UCLASS()
+class YOMISURVIVAL_API UYomiCombatSimCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UYomiCombatSimCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,128 @@
+// Copyright (c) 2026 Yomi Survival. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Core/YomiGameTypes.h"
+#include "YomiDamageSubsystem.generated.h"
+
+class AYomiCharacterBase;
+
+/**
+ * Combat totals for one resolved frame.
+ */
+struct FYomiCombatFrameStats
+{
+	int32 NumEvents = 0;
+	int32 NumTargets = 0;
+	int32 NumKills = 0;
+	int32 NumKnockbacks = 0;
+
+	/** Hits dropped because the target was already dead or gone. */
+	int32 NumDiscarded = 0;
+
+	float TotalDamage = 0.0f;
+	float DamageByType[static_cast<int32>(EDamageType::MAX)] = {};
+	float DamageBySource[static_cast<int32>(EDamageSource::MAX)] = {};
+};
+
+/**
+ * World subsystem that owns the damage queue.
+ * Melee, projectiles, area attacks and status effects queue hits during the frame;
+ * the queue is resolved in one pass at the end of the frame against each target's
+ * flat resistance table, and every damaged character receives a single health change
+ * and a single notification. Knockback from area attacks is launched in the same pass,
+ * once per character. Server only.
+ */
+UCLASS()
+class YOMISURVIVAL_API UYomiDamageSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UYomiDamageSubsystem, STATGROUP_Tickables); }
+
+	/** Queue raw (pre-resistance) damage to be resolved at the end of the frame. */
+	UFUNCTION(BlueprintCallable, Category = "Combat")
+	void QueueDamage(AYomiCharacterBase* Target, float Amount, EDamageType DamageType, AActor* DamageCauser, EDamageSource Source);
+
+	/** Resolve everything queued so far. Called automatically once per frame. */
+	void FlushDamageQueue();
+
+	UFUNCTION(BlueprintPure, Category = "Combat")
+	int32 GetNumQueuedEvents() const { return Queue.Num(); }
+
+	// ========================================================================
+	// AREA ATTACKS
+	// ========================================================================
+
+	/**
+	 * Queue Damage (scaled by Attack.DamageScale) and knockback for every hostile character inside
+	 * Attack's shape, found with one character registry query. Returns the number of targets. Server only.
+	 */
+	int32 QueueAreaAttack(const FYomiAreaAttack& Attack, const FVector& Origin, const FVector& Forward, float Damage, EDamageType DamageType,
+		AYomiCharacterBase* Instigator, AActor* DamageCauser, EDamageSource Source, TArray<AYomiCharacterBase*>* OutTargets = nullptr);
+
+	/** Launch Target once this frame's damage is resolved; several pushes in one frame add up. Server only. */
+	void QueueKnockback(AYomiCharacterBase* Target, const FVector& LaunchVelocity);
+
+	const FYomiCombatFrameStats& GetLastFrameStats() const { return LastFrameStats; }
+
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnCombatFrameResolved, const FYomiCombatFrameStats&);
+
+	/** Fired after each non-empty resolve pass, for telemetry and debug overlays. */
+	FOnCombatFrameResolved OnCombatFrameResolved;
+
+private:
+	struct FDamageEvent
+	{
+		TWeakObjectPtr<AYomiCharacterBase> Target;
+		TWeakObjectPtr<AActor> Causer;
+		float Amount = 0.0f;
+		EDamageType DamageType = EDamageType::None;
+		EDamageSource Source = EDamageSource::Melee;
+	};
+
+	/** Running result for one target during a resolve pass. */
+	struct FTargetResult
+	{
+		AYomiCharacterBase* Target = nullptr;
+		float RemainingHealth = 0.0f;
+		float TotalDamage = 0.0f;
+
+		/** The largest single hit names the type and causer of the combined notification. */
+		float LargestHit = 0.0f;
+		EDamageType LargestType = EDamageType::None;
+		AActor* LargestCauser = nullptr;
+	};
+
+	struct FKnockback
+	{
+		TWeakObjectPtr<AYomiCharacterBase> Target;
+		FVector LaunchVelocity = FVector::ZeroVector;
+	};
+
+	/** Launch every surviving knocked-back character, after damage so the dead are left alone. */
+	void ApplyKnockbacks();
+
+	TArray<FDamageEvent> Queue;
+
+	/** The batch being resolved; swapped with Queue each pass so neither buffer reallocates. */
+	TArray<FDamageEvent> ResolvingEvents;
+
+	/** One entry per target, summed as pushes are queued. */
+	TArray<FKnockback> Knockbacks;
+	TMap<TObjectKey<AYomiCharacterBase>, int32> KnockbackIndices;
+
+	/** Scratch for area attack queries. */
+	TArray<AYomiCharacterBase*> AreaCandidates;
+
+	/** Reused between frames to avoid reallocating. */
+	TArray<FTargetResult> Results;
+	TMap<AYomiCharacterBase*, int32> ResultIndices;
+
+	FYomiCombatFrameStats LastFrameStats;
+};
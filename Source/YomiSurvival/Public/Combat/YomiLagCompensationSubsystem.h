@@ -0,0 +1,110 @@
+// Copyright (c) 2026 Yomi Survival. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "YomiLagCompensationSubsystem.generated.h"
+
+class AYomiCharacterBase;
+
+/**
+ * A character's collision capsule at one moment in server time.
+ */
+struct FYomiHitboxSample
+{
+	float Time = 0.0f;
+	FVector Location = FVector::ZeroVector;
+	FQuat Rotation = FQuat::Identity;
+	float Radius = 0.0f;
+	float HalfHeight = 0.0f;
+
+	/** End points of the capsule's inner segment. */
+	void GetSegment(FVector& OutA, FVector& OutB) const;
+};
+
+/**
+ * Server-side hitbox history for lag-compensated hit validation.
+ * Every character gets a fixed block of HistoryLength samples in one contiguous array,
+ * written as a ring buffer once per server net tick. Hits reported by clients are checked
+ * against the capsule interpolated back to the moment the client saw it, so what
+ * a 150 ms client sees is what the server accepts. Rewinds never allocate and
+ * touch at most HistoryLength samples.
+ */
+UCLASS(Config = Game)
+class YOMISURVIVAL_API UYomiLagCompensationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UYomiLagCompensationSubsystem, STATGROUP_Tickables); }
+
+	// ========================================================================
+	// TRACKING
+	// ========================================================================
+
+	void RegisterCharacter(AYomiCharacterBase* Character);
+	void UnregisterCharacter(AYomiCharacterBase* Character);
+
+	// ========================================================================
+	// VALIDATION
+	// ========================================================================
+
+	/** The character's capsule at server Time, interpolated from history. False if it is not tracked. */
+	bool RewindCharacter(const AYomiCharacterBase* Character, float Time, FYomiHitboxSample& OutSample) const;
+
+	/**
+	 * Whether a swept segment of QueryRadius from Start to End touches Target as it was at ClientTime.
+	 * ClientTime is clamped to MaxRewindTime behind the server.
+	 */
+	bool ValidateHit(const AYomiCharacterBase* Target, const FVector& Start, const FVector& End, float QueryRadius, float ClientTime) const;
+
+	/**
+	 * Server time of the world a locally controlled pawn is looking at:
+	 * the synchronised server clock minus half the round trip.
+	 */
+	static float GetViewTimestamp(const APawn* Viewer);
+
+	float GetMaxRewindTime() const { return MaxRewindTime; }
+
+private:
+	/** Samples kept per character. Sampling is throttled so they always span MaxRewindTime. */
+	static constexpr int32 HistoryLength = 32;
+
+	struct FTrack
+	{
+		TWeakObjectPtr<AYomiCharacterBase> Character;
+
+		/** Ring position of the newest sample. */
+		int32 Head = INDEX_NONE;
+		int32 NumSamples = 0;
+	};
+
+	void SampleAll(float Now);
+
+	/** First sample of a slot's block in Samples. */
+	static int32 BlockStart(int32 Slot) { return Slot * HistoryLength; }
+
+	/** History samples per second. Zero samples every server tick, each of which flushes the net driver. */
+	UPROPERTY(Config)
+	float SampleRate = 0.0f;
+
+	/** Clients further behind than this are validated against the oldest allowed pose. */
+	UPROPERTY(Config)
+	float MaxRewindTime = 0.4f;
+
+	/** Slack added to every test for quantisation and interpolation error. */
+	UPROPERTY(Config)
+	float HitTolerance = 20.0f;
+
+	/** HistoryLength samples per slot, slot after slot. */
+	TArray<FYomiHitboxSample> Samples;
+
+	TArray<FTrack> Tracks;
+	TArray<int32> FreeSlots;
+	TMap<TObjectKey<AYomiCharacterBase>, int32> SlotIndices;
+
+	float TimeSinceSample = 0.0f;
+};
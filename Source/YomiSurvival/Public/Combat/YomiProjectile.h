@@ -5,27 +5,51 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "Core/YomiGameTypes.h"
+#include "Core/YomiActorPoolSubsystem.h"
 #include "YomiProjectile.generated.h"
 
 class USphereComponent;
 class UProjectileMovementComponent;
 class UStaticMeshComponent;
 class UNiagaraComponent;
+class UNiagaraSystem;
+class UStaticMesh;
 
 /**
  * Projectile for ranged weapons (arrows, shuriken, kunai, spirit arrows).
+ * Ranged weapons do not spawn these per shot: UYomiProjectileSubsystem reads the class
+ * defaults (mesh, radius, gravity, lifetime, effects) and simulates the flight itself.
+ * Anything that does need a live projectile actor spawns it with SpawnProjectile, which is pooled.
  */
 UCLASS()
-class YOMISURVIVAL_API AYomiProjectile : public AActor
+class YOMISURVIVAL_API AYomiProjectile : public AActor, public IYomiPoolable
 {
 	GENERATED_BODY()
 
 public:
 	AYomiProjectile();
 
+	/** Acquire a projectile from the actor pool and launch it along Transform's forward vector. */
+	UFUNCTION(BlueprintCallable, Category = "Projectile", meta = (WorldContext = "WorldContextObject"))
+	static AYomiProjectile* SpawnProjectile(UObject* WorldContextObject, TSubclassOf<AYomiProjectile> ProjectileClass, const FTransform& Transform,
+		APawn* InstigatorPawn, float InDamage, EDamageType InDamageType, float InSpeed);
+
 	UFUNCTION(BlueprintCallable, Category = "Projectile")
 	void InitializeProjectile(float InDamage, EDamageType InDamageType, float InSpeed);
 
+	// Archetype settings read by UYomiProjectileSubsystem
+	UStaticMesh* GetProjectileMesh() const;
+	FTransform GetMeshRelativeTransform() const;
+	float GetCollisionRadius() const;
+	float GetGravityScale() const;
+	float GetProjectileLifeSpan() const { return LifeSpan; }
+	bool ShouldStick() const { return bShouldStick; }
+	UNiagaraSystem* GetTrailSystem() const;
+	UNiagaraSystem* GetImpactEffect() const { return ImpactEffect; }
+
+	// IYomiPoolable
+	virtual void OnAcquiredFromPool() override;
+
 protected:
 	virtual void BeginPlay() override;
 
@@ -37,6 +61,9 @@ protected:
 	void OnOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
 		UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
 
+	/** Hand the actor back to the pool, or destroy it when there is none. */
+	void Retire();
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	TObjectPtr<USphereComponent> CollisionComponent;
 
@@ -60,4 +87,8 @@ protected:
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile")
 	bool bShouldStick = true;
+
+	/** Played where the projectile hits something. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Projectile")
+	TObjectPtr<UNiagaraSystem> ImpactEffect;
 };
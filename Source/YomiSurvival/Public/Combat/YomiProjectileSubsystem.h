@@ -0,0 +1,191 @@
+// Copyright (c) 2026 Yomi Survival. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/NetSerialization.h"
+#include "Core/YomiGameTypes.h"
+#include "YomiProjectileSubsystem.generated.h"
+
+class AYomiProjectile;
+class UInstancedStaticMeshComponent;
+class UNiagaraComponent;
+class UNiagaraSystem;
+class UStaticMesh;
+class USceneComponent;
+
+/**
+ * A projectile launch, replicated to clients so they can simulate the flight cosmetically.
+ */
+USTRUCT()
+struct FYomiProjectileLaunch
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TSubclassOf<AYomiProjectile> Archetype;
+
+	UPROPERTY()
+	FVector_NetQuantize10 Origin;
+
+	UPROPERTY()
+	FVector_NetQuantizeNormal Direction;
+
+	UPROPERTY()
+	float Speed = 0.0f;
+
+	UPROPERTY()
+	TObjectPtr<AActor> Instigator = nullptr;
+};
+
+/**
+ * Render and simulation settings read once from an AYomiProjectile class default object.
+ */
+USTRUCT()
+struct FYomiProjectileArchetype
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TWeakObjectPtr<UClass> Class;
+
+	UPROPERTY()
+	TObjectPtr<UStaticMesh> Mesh = nullptr;
+
+	FTransform MeshTransform = FTransform::Identity;
+	float Radius = 10.0f;
+	float GravityScale = 1.0f;
+	float LifeSpan = 5.0f;
+	bool bShouldStick = true;
+
+	UPROPERTY()
+	TObjectPtr<UNiagaraSystem> TrailEffect = nullptr;
+
+	UPROPERTY()
+	TObjectPtr<UNiagaraSystem> ImpactEffect = nullptr;
+
+	/** Created on first use, absent on dedicated servers. */
+	UPROPERTY()
+	TObjectPtr<UInstancedStaticMeshComponent> Instances = nullptr;
+};
+
+/**
+ * World subsystem that simulates every in-flight projectile.
+ * Projectiles are plain struct-of-arrays state integrated in one pass, then swept against
+ * the world in a second pass: one sphere sweep per projectile, sharing a single query setup.
+ * They are drawn through one instanced mesh per projectile archetype, and only trail and
+ * impact effects use (pooled) Niagara components.
+ * AYomiProjectile subclasses act as archetypes: their defaults describe mesh, radius,
+ * gravity, lifetime and effects, but no actor is spawned per shot.
+ * Projectiles that stick become a bone-relative transform in a separate, render-only list,
+ * capped per target with the oldest evicted first.
+ */
+UCLASS()
+class YOMISURVIVAL_API UYomiProjectileSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UYomiProjectileSubsystem, STATGROUP_Tickables); }
+
+	/**
+	 * Launch a damaging projectile. Server only; clients receive the launch in a per-frame batch
+	 * and simulate a cosmetic copy.
+	 */
+	void LaunchProjectile(TSubclassOf<AYomiProjectile> Archetype, const FVector& Origin, const FVector& Direction,
+		float Speed, float Damage, EDamageType DamageType, AActor* Instigator, const FYomiStatusInfliction& OnHitStatus = FYomiStatusInfliction());
+
+	/** Called on clients when a batch of launches arrives. */
+	void HandleLaunchBatch(const TArray<FYomiProjectileLaunch>& Launches);
+
+	/**
+	 * Leave a stuck copy of Archetype's mesh where Hit landed, following the hit bone or component.
+	 * Does nothing where visuals are not rendered.
+	 */
+	void StickProjectile(TSubclassOf<AYomiProjectile> Archetype, const FHitResult& Hit, const FQuat& Orientation);
+
+	UFUNCTION(BlueprintPure, Category = "Combat")
+	int32 GetNumActiveProjectiles() const { return Positions.Num(); }
+
+	UFUNCTION(BlueprintPure, Category = "Combat")
+	int32 GetNumStuckProjectiles() const { return StuckParents.Num(); }
+
+private:
+	enum EProjectileFlags : uint8
+	{
+		PF_None = 0,
+		/** Client-side copy; never deals damage. */
+		PF_Cosmetic = 1 << 0,
+	};
+
+	/** How long stuck projectiles stay visible. */
+	static constexpr float StuckLifeSpan = 10.0f;
+
+	/** Stuck projectiles kept per character, and per any other actor such as the landscape. */
+	static constexpr int32 MaxStuckPerCharacter = 12;
+	static constexpr int32 MaxStuckPerActor = 64;
+
+	int32 FindOrAddArchetype(TSubclassOf<AYomiProjectile> Class);
+	int32 AddProjectile(int32 ArchetypeIndex, const FVector& Origin, const FVector& Velocity, float Damage, EDamageType DamageType, AActor* Instigator, uint8 Flags,
+		const FYomiStatusInfliction& OnHitStatus = FYomiStatusInfliction());
+	void RemoveProjectileAt(int32 Index);
+
+	void AddStuckProjectile(int32 ArchetypeIndex, const FHitResult& Hit, const FQuat& Orientation);
+	void RemoveStuckAt(int32 Index);
+
+	/** Drop stuck projectiles that timed out or whose parent went away. */
+	void ExpireStuckProjectiles();
+
+	void Simulate(float DeltaTime);
+	void ResolveImpact(int32 Index, const FHitResult& Hit);
+	void UpdateVisuals();
+
+	bool ShouldRenderVisuals() const;
+
+	UPROPERTY()
+	TArray<FYomiProjectileArchetype> Archetypes;
+
+	// Struct-of-arrays projectile state, all arrays share the same index
+	TArray<FVector> Positions;
+	TArray<FVector> Velocities;
+	TArray<float> TimeRemaining;
+	TArray<float> Damages;
+	TArray<EDamageType> DamageTypes;
+	TArray<uint16> ArchetypeIndices;
+	TArray<uint8> Flags;
+	TArray<TWeakObjectPtr<AActor>> Instigators;
+	TArray<FYomiStatusInfliction> StatusInflictions;
+
+	// Struct-of-arrays stuck projectiles, render-only and never simulated
+	TArray<uint16> StuckArchetypes;
+	TArray<TWeakObjectPtr<USceneComponent>> StuckParents;
+	TArray<FName> StuckBones;
+
+	/** Projectile transform relative to the parent bone or component. */
+	TArray<FTransform> StuckOffsets;
+	TArray<float> StuckExpiryTimes;
+	TArray<TObjectKey<AActor>> StuckOwners;
+
+	/** Order stuck, so the oldest on a target is evicted first. */
+	TArray<uint32> StuckSerials;
+
+	TMap<TObjectKey<AActor>, int32> StuckCounts;
+	uint32 NextStuckSerial = 0;
+
+	/** Pooled trail component per projectile, null when the archetype has none or visuals are off. */
+	UPROPERTY()
+	TArray<TObjectPtr<UNiagaraComponent>> Trails;
+
+	/** Owns the instanced mesh components. */
+	UPROPERTY()
+	TObjectPtr<AActor> VisualsActor;
+
+	/** Launches made this frame, sent to clients in a single multicast. */
+	TArray<FYomiProjectileLaunch> PendingLaunches;
+
+	/** Scratch buffer for instance transforms. */
+	TArray<FTransform> InstanceTransforms;
+};
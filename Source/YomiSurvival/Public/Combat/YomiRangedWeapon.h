@@ -11,6 +11,9 @@ class AYomiProjectile;
 /**
  * Ranged weapon class for bows (Yumi/Daikyu), thrown weapons (Shuriken/Kunai),
  * blowgun (Fukiya), and matchlock gun (Teppo).
+ *
+ * Charge and reload are timestamps read on demand, so an idle weapon never ticks.
+ * It ticks only while charging with something bound to OnChargeChanged to draw it.
  */
 UCLASS()
 class YOMISURVIVAL_API AYomiRangedWeapon : public AYomiWeaponBase
@@ -20,6 +23,9 @@ class YOMISURVIVAL_API AYomiRangedWeapon : public AYomiWeaponBase
 public:
 	AYomiRangedWeapon();
 
+	/** No shot while reloading or out of ammo. */
+	virtual bool CanStartAttack() const override;
+
 	virtual void StartLightAttack() override;
 	virtual void StartHeavyAttack() override;
 	virtual void StartSpecialAttack() override;
@@ -38,17 +44,32 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Ranged")
 	bool IsCharging() const { return bIsCharging; }
 
+	UFUNCTION(BlueprintPure, Category = "Ranged")
+	bool IsReloading() const;
+
 	UFUNCTION(BlueprintPure, Category = "Ranged")
 	int32 GetCurrentAmmo() const { return CurrentAmmo; }
 
 	UFUNCTION(BlueprintCallable, Category = "Ranged")
 	void AddAmmo(int32 Amount);
 
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnChargeChanged, float, ChargePercent);
+
+	/** Fired every frame while charging, for the aim arc and bow bend. Bind before the charge starts. */
+	UPROPERTY(BlueprintAssignable, Category = "Events")
+	FOnChargeChanged OnChargeChanged;
+
 protected:
 	virtual void Tick(float DeltaTime) override;
 
 	void FireProjectile(float ChargeMultiplier = 1.0f);
 
+	/**
+	 * Replace Direction with the lead on the owner's locked-on target when it is close enough.
+	 * Runs where the projectile is launched; the server learns a remote player's lock through ServerSetLockedTarget.
+	 */
+	void ApplyAimAssist(const FVector& LaunchLocation, float Speed, FVector& Direction) const;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ranged")
 	TSubclassOf<AYomiProjectile> ProjectileClass;
 
@@ -73,9 +94,20 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ranged")
 	float ReloadTime = 1.0f;
 
+	/**
+	 * Shots within this many degrees of the locked-on target are bent onto its intercept arc.
+	 * Zero turns aim assist off.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ranged")
+	float AimAssistAngle = 0.0f;
+
 private:
 	bool bIsCharging = false;
-	float CurrentChargeTime = 0.0f;
+	float ChargeStartTime = 0.0f;
 	int32 CurrentAmmo;
-	float ReloadTimer = 0.0f;
+
+	/** World time the next shot is allowed. */
+	float ReloadEndTime = 0.0f;
+
+	float GetWorldTime() const;
 };
@@ -0,0 +1,101 @@
+// Copyright (c) 2026 Yomi Survival. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Core/YomiGameTypes.h"
+#include "YomiStatusEffectSubsystem.generated.h"
+
+class AYomiCharacterBase;
+
+/**
+ * World subsystem that owns every active status effect (poison, burn, curse, slow).
+ * Effects are struct-of-arrays entries advanced together once per frame: due ticks are
+ * found in one pass over the timing arrays and their damage is queued into
+ * UYomiDamageSubsystem as a single batch. Stacking and tick rates come from
+ * FStatusEffectData. A character's icon list and speed penalty are pushed to it only
+ * when its effects change, and replicate to the owning client. Server only.
+ */
+UCLASS()
+class YOMISURVIVAL_API UYomiStatusEffectSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UYomiStatusEffectSubsystem, STATGROUP_Tickables); }
+
+	/** Apply or stack Effect on Target following its stacking rule. Returns false if nothing changed. */
+	bool ApplyStatusEffect(AYomiCharacterBase* Target, EYomiStatusEffect Effect, float Magnitude, float Duration, AActor* Source);
+
+	/** Roll Infliction's chance and apply it. */
+	bool ApplyInfliction(AYomiCharacterBase* Target, const FYomiStatusInfliction& Infliction, AActor* Source);
+
+	void RemoveStatusEffect(AYomiCharacterBase* Target, EYomiStatusEffect Effect);
+	void ClearStatusEffects(AYomiCharacterBase* Target);
+
+	UFUNCTION(BlueprintPure, Category = "Status")
+	bool HasStatusEffect(const AYomiCharacterBase* Target, EYomiStatusEffect Effect) const;
+
+	UFUNCTION(BlueprintPure, Category = "Status")
+	int32 GetNumActiveEffects() const { return Targets.Num(); }
+
+private:
+	static constexpr int32 NumEffects = static_cast<int32>(EYomiStatusEffect::MAX);
+
+	/** Flattened FStatusEffectData, indexed by EYomiStatusEffect. */
+	struct FEffectRules
+	{
+		EDamageType DamageType = EDamageType::None;
+		float TickInterval = 0.0f;
+		EStatusStacking Stacking = EStatusStacking::Refresh;
+		int32 MaxStacks = 1;
+		float MaxDuration = 10.0f;
+		float MaxSpeedReduction = 0.0f;
+	};
+
+	using FEntryKey = TPair<TObjectKey<AYomiCharacterBase>, EYomiStatusEffect>;
+
+	void LoadRules();
+
+	int32 FindEntry(const AYomiCharacterBase* Target, EYomiStatusEffect Effect) const;
+	void RemoveEntryAt(int32 Index);
+
+	/** Queue one batch of damage for every tick that fell due this frame. */
+	void ProcessTicks(float Now);
+
+	/** Drop expired entries and those whose target died or left play. */
+	void ProcessExpiry(float Now);
+
+	void MarkDirty(AYomiCharacterBase* Target);
+
+	/** Push icons and speed penalty to every character whose effects changed. */
+	void FlushDirtyTargets();
+
+	FEffectRules Rules[NumEffects];
+
+	// Struct-of-arrays effect state, all arrays share the same index
+	TArray<TWeakObjectPtr<AYomiCharacterBase>> Targets;
+
+	/** Stays valid after the target is gone, so stale entries can still be unmapped. */
+	TArray<TObjectKey<AYomiCharacterBase>> TargetKeys;
+
+	TArray<EYomiStatusEffect> Effects;
+	TArray<float> Magnitudes;
+	TArray<uint8> Stacks;
+	TArray<float> ExpiryTimes;
+	TArray<float> NextTickTimes;
+	TArray<float> TickIntervals;
+	TArray<TWeakObjectPtr<AActor>> Sources;
+
+	TMap<FEntryKey, int32> EntryIndices;
+
+	/** Characters whose effects changed since the last flush. */
+	TArray<TWeakObjectPtr<AYomiCharacterBase>> DirtyTargets;
+
+	/** Scratch for the tick pass. */
+	TArray<int32> DueEntries;
+};
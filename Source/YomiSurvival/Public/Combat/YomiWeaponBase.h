@@ -5,11 +5,13 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "Core/YomiGameTypes.h"
+#include "Combat/YomiCombatRules.h"
 #include "YomiWeaponBase.generated.h"
 
 class UBoxComponent;
 class USkeletalMeshComponent;
 class UNiagaraComponent;
+class AYomiCharacterBase;
 
 /**
  * Base class for all weapons in Yomi Survival.
@@ -46,6 +48,10 @@ public:
 	// COMBAT
 	// ========================================================================
 
+	/** Whether a Start*Attack call would actually attack. The combat component checks it before spending anything. */
+	UFUNCTION(BlueprintPure, Category = "Combat")
+	virtual bool CanStartAttack() const { return !IsBroken(); }
+
 	UFUNCTION(BlueprintCallable, Category = "Combat")
 	virtual void StartLightAttack();
 
@@ -73,6 +79,17 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Combat")
 	float CalculateDamage(bool bIsHeavyAttack, bool bIsStealthAttack) const;
 
+	/** Apply a client-reported hit the server has already validated. Server only. */
+	void ProcessReportedHit(AYomiCharacterBase* Target, const FHitResult& HitResult);
+
+	float GetBladeSweepRadius() const { return BladeSweepRadius; }
+
+	/** Which part of the weapon made the latest swing hit, for weapons that strike with more than one. Sent with reported hits. */
+	virtual uint8 GetLastHitPart() const { return 0; }
+
+	/** Radius the server sweeps when validating a reported hit made with HitPart. */
+	virtual float GetHitValidationRadius(uint8 HitPart) const { return BladeSweepRadius; }
+
 	// ========================================================================
 	// COMBO SYSTEM
 	// ========================================================================
@@ -134,6 +151,11 @@ public:
 protected:
 	virtual void BeginPlay() override;
 
+	/** Only enabled while the damage window is open in swept trace mode. */
+	virtual void Tick(float DeltaTime) override;
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
 	UFUNCTION()
 	void OnDamageBoxOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
 		UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
@@ -155,26 +177,96 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weapon")
 	FWeaponData WeaponData;
 
+	/** WeaponData is not replicated; clients look it up from this type through the data subsystem. */
+	UPROPERTY(ReplicatedUsing = OnRep_WeaponType)
+	EWeaponType ReplicatedWeaponType = EWeaponType::None;
+
+	UFUNCTION()
+	void OnRep_WeaponType();
+
 	UPROPERTY()
 	TObjectPtr<ACharacter> WeaponOwner;
 
 	// State
 	int32 CurrentDurability;
 	int32 CurrentComboCount = 0;
-	int32 MaxCombo = 3;
+	int32 MaxCombo = YomiCombatRules::MaxCombo;
 	float ComboTimer = 0.0f;
 	float ComboWindowDuration = 1.5f;
 	bool bIsBlocking = false;
 	bool bDamageEnabled = false;
 
 	// Track what we've hit this swing to avoid double-hits
-	TArray<AActor*> HitActorsThisSwing;
+	TSet<TObjectKey<AActor>, DefaultKeyFuncs<TObjectKey<AActor>>, TInlineSetAllocator<8>> HitActorsThisSwing;
+
+	// Swept hit detection
+	UPROPERTY(EditAnywhere, Category = "Combat|Hit Detection")
+	EMeleeHitDetection HitDetectionMode = EMeleeHitDetection::SweptTrace;
+
+	UPROPERTY(EditAnywhere, Category = "Combat|Hit Detection")
+	FName BladeBaseSocket = TEXT("blade_base");
+
+	UPROPERTY(EditAnywhere, Category = "Combat|Hit Detection")
+	FName BladeTipSocket = TEXT("blade_tip");
+
+	/** Blade samples per second, independent of the frame rate. */
+	UPROPERTY(EditAnywhere, Category = "Combat|Hit Detection", meta = (ClampMin = "10"))
+	float SweepSubstepRate = 120.0f;
+
+	/** Caps the work done after a long hitch. */
+	UPROPERTY(EditAnywhere, Category = "Combat|Hit Detection", meta = (ClampMin = "1"))
+	int32 MaxSweepSubsteps = 16;
+
+	UPROPERTY(EditAnywhere, Category = "Combat|Hit Detection")
+	float BladeSweepRadius = 5.0f;
+
+	FVector PreviousBladeBase = FVector::ZeroVector;
+	FVector PreviousBladeTip = FVector::ZeroVector;
+
+	/** Current blade segment, from the sockets or the damage box when they are missing. */
+	virtual void GetBladeSegment(FVector& OutBase, FVector& OutTip) const;
+
+	/** Sweep the blade from its previous sample to the current pose in fixed sub-steps. */
+	void SweepBlade(float DeltaTime);
+
+	/** True where this machine detects hits for the swing: the owning client for players, the server otherwise. */
+	bool ShouldSweepLocally() const;
+
+	/** Detected a hit: resolve it on the server, report it from the owning client. */
+	void ProcessSwingHit(AActor* OtherActor, const FHitResult& HitResult);
+
+	/** Queue damage and notify for an accepted hit. */
+	virtual void ApplySwingHit(AActor* OtherActor, const FHitResult& HitResult);
+
+	/** How long after the damage window closes client reports are still accepted. */
+	UPROPERTY(EditAnywhere, Category = "Combat|Hit Detection")
+	float ReportedHitGraceTime = 0.4f;
+
+	float DamageWindowClosedTime = -1.0f;
+
+	// Area attacks
+	UPROPERTY(EditAnywhere, Category = "Combat|Area Attack", meta = (InlineEditConditionToggle))
+	bool bOverrideSweepAttack = false;
+
+	/** Heavy and special swings hit everything in this shape at once instead of tracing the blade. Derived from the weapon class unless overridden. */
+	UPROPERTY(EditAnywhere, Category = "Combat|Area Attack", meta = (EditCondition = "bOverrideSweepAttack"))
+	FYomiAreaAttack SweepAttack;
+
+	/** The current swing resolves as SweepAttack when the damage window opens. */
+	bool bAreaSwing = false;
+	bool bHeavySwing = false;
+
+	/** Hit every foe inside SweepAttack around the owner in one batched update. Server only. */
+	void PerformAreaAttack();
+
+	/** Reused between swings to avoid reallocating. */
+	TArray<AYomiCharacterBase*> AreaTargets;
 
 	// Combo damage multiplier
 	UPROPERTY(EditAnywhere, Category = "Combat")
-	float ComboMultiplierPerHit = 0.15f;
+	float ComboMultiplierPerHit = YomiCombatRules::ComboMultiplierPerHit;
 
 	// Heavy attack multiplier
 	UPROPERTY(EditAnywhere, Category = "Combat")
-	float HeavyAttackMultiplier = 2.0f;
+	float HeavyAttackMultiplier = YomiCombatRules::HeavyAttackMultiplier;
 };
@@ -0,0 +1,132 @@
+// Copyright (c) 2026 Yomi Survival. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineTypes.h"
+#include "UObject/Interface.h"
+#include "Templates/Function.h"
+#include "YomiActorPoolSubsystem.generated.h"
+
+UINTERFACE(MinimalAPI, meta = (CannotImplementInterfaceInBlueprint))
+class UYomiPoolable : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Optional hooks for actors handed out by UYomiActorPoolSubsystem.
+ * BeginPlay and EndPlay only run once per actor; these run on every trip in and out of the pool.
+ */
+class YOMISURVIVAL_API IYomiPoolable
+{
+	GENERATED_BODY()
+
+public:
+	/** Called each time the actor is handed out, after it has been placed, registered and re-enabled. */
+	virtual void OnAcquiredFromPool() {}
+
+	/** Called before the actor is parked. Drop targets, timers and registrations here. */
+	virtual void OnReturnedToPool() {}
+};
+
+/**
+ * Per-class pool counters.
+ */
+struct FYomiActorPoolStats
+{
+	int32 NumFree = 0;
+	int32 NumInUse = 0;
+
+	/** Actors this pool has ever spawned, including pre-warming. */
+	int32 NumSpawned = 0;
+
+	int32 NumAcquired = 0;
+	int32 NumReleased = 0;
+
+	/** Acquires that found the pool empty and had to spawn. */
+	int32 NumMisses = 0;
+
+	/** Releases that found the pool full and destroyed the actor instead. */
+	int32 NumDestroyed = 0;
+};
+
+/**
+ * World subsystem that recycles short-lived gameplay actors (corpses, ghost pieces, pickups, minions).
+ * Parked actors keep their UObjects but have every component unregistered, all ticking
+ * turned off and are hidden, so they cost neither rendering, physics nor tick time.
+ * Acquiring one restores it in place of SpawnActor; releasing it replaces Destroy and SetLifeSpan.
+ */
+UCLASS(Config = Game)
+class YOMISURVIVAL_API UYomiActorPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	/** Spawn and park actors ahead of time, so the first acquires do not hit SpawnActor. */
+	void Prewarm(TSubclassOf<AActor> Class, int32 Count);
+
+	/**
+	 * Hand out an actor of Class at Transform, spawning one if the pool is empty.
+	 * Configure runs before BeginPlay on a fresh actor, whose native components are already
+	 * registered by then, and before a recycled actor's components re-register.
+	 * When CollisionHandling asks for an adjusted spawn, recycled actors are nudged out of blocking geometry too.
+	 */
+	AActor* AcquireActor(TSubclassOf<AActor> Class, const FTransform& Transform, AActor* Owner = nullptr, APawn* Instigator = nullptr,
+		TFunctionRef<void(AActor*)> Configure = [](AActor*) {},
+		ESpawnActorCollisionHandlingMethod CollisionHandling = ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+
+	template<typename T>
+	T* AcquireActor(TSubclassOf<T> Class, const FTransform& Transform, AActor* Owner = nullptr, APawn* Instigator = nullptr,
+		TFunctionRef<void(AActor*)> Configure = [](AActor*) {},
+		ESpawnActorCollisionHandlingMethod CollisionHandling = ESpawnActorCollisionHandlingMethod::AlwaysSpawn)
+	{
+		return Cast<T>(AcquireActor(TSubclassOf<AActor>(Class), Transform, Owner, Instigator, Configure, CollisionHandling));
+	}
+
+	/** Park an actor for reuse. Actors that did not come from the pool are adopted. */
+	void ReleaseActor(AActor* Actor);
+
+	/** Park an actor after a delay, in place of SetLifeSpan. */
+	void ReleaseActorAfter(AActor* Actor, float Delay);
+
+	bool IsParked(const AActor* Actor) const { return ParkedActors.Contains(Actor); }
+
+	/** Destroy parked actors of Class beyond MaxFree. */
+	void TrimPool(TSubclassOf<AActor> Class, int32 MaxFree);
+
+	FYomiActorPoolStats GetPoolStats(TSubclassOf<AActor> Class) const;
+	FYomiActorPoolStats GetTotalStats() const;
+
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnPooledActorReleased, AActor*);
+
+	/** Fired as an actor is parked, so anything still targeting it can let go. */
+	FOnPooledActorReleased OnActorReleased;
+
+private:
+	struct FPool
+	{
+		TArray<TWeakObjectPtr<AActor>> Free;
+		FYomiActorPoolStats Stats;
+	};
+
+	AActor* SpawnPooledActor(UClass* Class, const FTransform& Transform, AActor* Owner, APawn* Instigator, TFunctionRef<void(AActor*)> Configure,
+		ESpawnActorCollisionHandlingMethod CollisionHandling = ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+	void ParkActor(AActor* Actor);
+	void ActivateActor(AActor* Actor, const FTransform& Transform, AActor* Owner, APawn* Instigator, TFunctionRef<void(AActor*)> Configure,
+		ESpawnActorCollisionHandlingMethod CollisionHandling);
+	void CancelPendingRelease(const AActor* Actor);
+
+	/** Parked actors kept per class; further releases are destroyed. */
+	UPROPERTY(Config)
+	int32 MaxFreeActorsPerClass = 32;
+
+	TMap<TObjectKey<UClass>, FPool> Pools;
+
+	TSet<TObjectKey<AActor>> InUseActors;
+	TSet<TObjectKey<AActor>> ParkedActors;
+	TMap<TObjectKey<AActor>, FTimerHandle> PendingReleases;
+};
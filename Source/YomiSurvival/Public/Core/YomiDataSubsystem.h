@@ -8,7 +8,7 @@
 #include "YomiDataSubsystem.generated.h"
 
 /**
- * Game instance subsystem that provides default weapon, armor, food, and biome data.
+ * Game instance subsystem that provides default weapon, armor, food, biome and status effect data.
  * This serves as the master data source for all game content definitions.
  * In production, this would be driven by DataTables/DataAssets; these defaults
  * provide the complete data set defined in the game design document.
@@ -21,6 +21,9 @@ class YOMISURVIVAL_API UYomiDataSubsystem : public UGameInstanceSubsystem
 public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 
+	/** Fill the databases with the built-in content. Also used by tools that run without a game instance. */
+	void LoadDefaultData();
+
 	// ========================================================================
 	// DATA ACCESS
 	// ========================================================================
@@ -46,17 +49,25 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Data")
 	TArray<FFoodData> GetAllFoods() const;
 
+	/** The database entry itself, for callers that hold on to the food type instead of a copy. */
+	const FFoodData* FindFoodData(EFoodType FoodType) const { return FoodDatabase.Find(FoodType); }
+
 	UFUNCTION(BlueprintPure, Category = "Data")
 	FBiomeData GetBiomeData(EYomiBiome Biome) const;
 
+	UFUNCTION(BlueprintPure, Category = "Data")
+	FStatusEffectData GetStatusEffectData(EYomiStatusEffect Effect) const;
+
 private:
 	void InitializeWeaponData();
 	void InitializeArmorData();
 	void InitializeFoodData();
 	void InitializeBiomeData();
+	void InitializeStatusEffectData();
 
 	TMap<EWeaponType, FWeaponData> WeaponDatabase;
 	TArray<FArmorData> ArmorDatabase;
 	TMap<EFoodType, FFoodData> FoodDatabase;
 	TMap<EYomiBiome, FBiomeData> BiomeDatabase;
+	TMap<EYomiStatusEffect, FStatusEffectData> StatusEffectDatabase;
 };
@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "GameFramework/GameStateBase.h"
 #include "Core/YomiGameTypes.h"
+#include "Building/YomiBuildingSubsystem.h"
+#include "Combat/YomiProjectileSubsystem.h"
 #include "YomiGameState.generated.h"
 
 /**
@@ -55,6 +57,22 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "GameState")
 	void AdvanceDay();
 
+	// ========================================================================
+	// BUILDING
+	// ========================================================================
+
+	/** Batched building health changes, at most one RPC per server frame. The pieces' own replicated health stays authoritative. */
+	UFUNCTION(NetMulticast, Unreliable)
+	void MulticastBuildingHealthBatch(const TArray<FYomiBuildingHealthUpdate>& Updates);
+
+	// ========================================================================
+	// COMBAT
+	// ========================================================================
+
+	/** Projectiles launched on the server this frame, simulated cosmetically on clients. */
+	UFUNCTION(NetMulticast, Unreliable)
+	void MulticastProjectilesFired(const TArray<FYomiProjectileLaunch>& Launches);
+
 protected:
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
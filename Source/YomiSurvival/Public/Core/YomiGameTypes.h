@@ -400,6 +400,18 @@ enum class EDamageType : uint8
 	MAX			UMETA(Hidden)
 };
 
+UENUM(BlueprintType)
+enum class EDamageSource : uint8
+{
+	Melee			UMETA(DisplayName = "Melee"),
+	Projectile		UMETA(DisplayName = "Projectile"),
+	AreaOfEffect	UMETA(DisplayName = "Area of Effect"),
+	StatusEffect	UMETA(DisplayName = "Status Effect"),
+	Environment		UMETA(DisplayName = "Environment"),
+
+	MAX				UMETA(Hidden)
+};
+
 UENUM(BlueprintType)
 enum class EHonorLevel : uint8
 {
@@ -440,6 +452,115 @@ enum class ECompanionType : uint8
 	MAX				UMETA(Hidden)
 };
 
+UENUM(BlueprintType)
+enum class EMeleeHitDetection : uint8
+{
+	Overlap			UMETA(DisplayName = "Overlap (Damage Box)"),
+	SweptTrace		UMETA(DisplayName = "Swept Trace (Blade Sockets)"),
+
+	MAX				UMETA(Hidden)
+};
+
+UENUM(BlueprintType)
+enum class EYomiAreaShape : uint8
+{
+	None			UMETA(DisplayName = "None"),
+	Arc				UMETA(DisplayName = "Arc (Horizontal Sweep)"),
+	Cone			UMETA(DisplayName = "Cone"),
+	Ring			UMETA(DisplayName = "Ring (Shockwave)"),
+
+	MAX				UMETA(Hidden)
+};
+
+UENUM(BlueprintType)
+enum class EYomiTeam : uint8
+{
+	None			UMETA(DisplayName = "None"),
+	Players			UMETA(DisplayName = "Players"),
+	Companions		UMETA(DisplayName = "Companions"),
+	Yokai			UMETA(DisplayName = "Yokai"),
+	Neutral			UMETA(DisplayName = "Neutral"),
+
+	MAX				UMETA(Hidden)
+};
+
+UENUM(BlueprintType)
+enum class EYomiCharacterKind : uint8
+{
+	None			UMETA(DisplayName = "None"),
+	Player			UMETA(DisplayName = "Player"),
+	Companion		UMETA(DisplayName = "Companion"),
+	Enemy			UMETA(DisplayName = "Enemy"),
+	Boss			UMETA(DisplayName = "Boss"),
+
+	MAX				UMETA(Hidden)
+};
+
+UENUM(BlueprintType)
+enum class EYomiPredictedAction : uint8
+{
+	None			UMETA(DisplayName = "None"),
+	LightAttack		UMETA(DisplayName = "Light Attack"),
+	HeavyAttack		UMETA(DisplayName = "Heavy Attack"),
+	SpecialAttack	UMETA(DisplayName = "Special Attack"),
+	DodgeRoll		UMETA(DisplayName = "Dodge Roll"),
+	KiDash			UMETA(DisplayName = "Ki Dash"),
+	KiPowerStrike	UMETA(DisplayName = "Ki Power Strike"),
+	KiSpiritArrow	UMETA(DisplayName = "Ki Spirit Arrow"),
+
+	MAX				UMETA(Hidden)
+};
+
+/** Character stats that modifiers can raise or lower. Damage and MoveSpeed are multipliers that start at 1. */
+UENUM(BlueprintType)
+enum class EYomiAttribute : uint8
+{
+	MaxHealth		UMETA(DisplayName = "Max Health"),
+	MaxStamina		UMETA(DisplayName = "Max Stamina"),
+	StaminaRegen	UMETA(DisplayName = "Stamina Regen"),
+	KiRegen			UMETA(DisplayName = "Ki Regen"),
+	MoveSpeed		UMETA(DisplayName = "Move Speed"),
+	Damage			UMETA(DisplayName = "Damage"),
+	PhysicalDefense	UMETA(DisplayName = "Physical Defense"),
+	SpiritDefense	UMETA(DisplayName = "Spirit Defense"),
+
+	MAX				UMETA(Hidden)
+};
+
+/** Where a modifier comes from; each source holds one layer per character. */
+UENUM(BlueprintType)
+enum class EYomiModifierSource : uint8
+{
+	Food			UMETA(DisplayName = "Food"),
+	Armor			UMETA(DisplayName = "Armor"),
+	Blessing		UMETA(DisplayName = "Blessing"),
+	StatusEffect	UMETA(DisplayName = "Status Effect"),
+
+	MAX				UMETA(Hidden)
+};
+
+UENUM(BlueprintType)
+enum class EYomiStatusEffect : uint8
+{
+	None			UMETA(DisplayName = "None"),
+	Poison			UMETA(DisplayName = "Poison"),
+	Burn			UMETA(DisplayName = "Burn"),
+	Curse			UMETA(DisplayName = "Curse"),
+	Slow			UMETA(DisplayName = "Slow"),
+
+	MAX				UMETA(Hidden)
+};
+
+UENUM(BlueprintType)
+enum class EStatusStacking : uint8
+{
+	Refresh			UMETA(DisplayName = "Refresh (Strongest Wins)"),
+	Intensity		UMETA(DisplayName = "Stack Intensity"),
+	Duration		UMETA(DisplayName = "Stack Duration"),
+
+	MAX				UMETA(Hidden)
+};
+
 UENUM(BlueprintType)
 enum class EBushidoChallenge : uint8
 {
@@ -491,6 +612,28 @@ struct FYomiItemData : public FTableRowBase
 	int32 BaseValue = 0;
 };
 
+/**
+ * A status effect a weapon or projectile applies on hit.
+ */
+USTRUCT(BlueprintType)
+struct FYomiStatusInfliction
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Status")
+	EYomiStatusEffect Effect = EYomiStatusEffect::None;
+
+	/** Damage per tick per stack, or the fraction of movement speed removed for slows. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Status")
+	float Magnitude = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Status")
+	float Duration = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Status", meta = (ClampMin = "0", ClampMax = "1"))
+	float Chance = 1.0f;
+};
+
 USTRUCT(BlueprintType)
 struct FWeaponData : public FTableRowBase
 {
@@ -541,6 +684,9 @@ struct FWeaponData : public FTableRowBase
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weapon")
 	float KnockbackForce = 100.0f;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weapon")
+	FYomiStatusInfliction OnHitStatus;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weapon")
 	bool bCanBlock = true;
 
@@ -696,6 +842,138 @@ struct FFoodData : public FTableRowBase
 	ECraftingStation RequiredStation = ECraftingStation::CookingStation;
 };
 
+/**
+ * How a status effect ticks and stacks, shared by every source that applies it.
+ */
+USTRUCT(BlueprintType)
+struct FStatusEffectData : public FTableRowBase
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Status")
+	EYomiStatusEffect Effect = EYomiStatusEffect::None;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Status")
+	FText DisplayName;
+
+	/** None for effects that deal no damage. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Status")
+	EDamageType DamageType = EDamageType::None;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Status")
+	float TickInterval = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Status")
+	EStatusStacking Stacking = EStatusStacking::Refresh;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Status")
+	int32 MaxStacks = 1;
+
+	/** No application, stacked or not, lasts longer than this. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Status")
+	float MaxDuration = 10.0f;
+
+	/** Cap on the movement speed fraction removed. Zero for effects that do not slow. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Status")
+	float MaxSpeedReduction = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Status")
+	TSoftObjectPtr<UTexture2D> Icon;
+};
+
+/**
+ * An active status effect as the affected player's HUD sees it.
+ */
+USTRUCT(BlueprintType)
+struct FYomiStatusEffectIcon
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Status")
+	EYomiStatusEffect Effect = EYomiStatusEffect::None;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Status")
+	uint8 Stacks = 0;
+
+	/** Server world time at which the effect wears off. */
+	UPROPERTY(BlueprintReadOnly, Category = "Status")
+	float EndTime = 0.0f;
+};
+
+/**
+ * A regenerating stat kept in closed form: Value at AnchorTime, moving at Rate per second up to
+ * the cap. Read by evaluating at the current server world time; only re-anchored when the value
+ * is set or the rate changes, so it replicates once per change rather than every frame.
+ */
+USTRUCT()
+struct FYomiRegenStat
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	float Value = 0.0f;
+
+	/** Server world time Value was taken at. */
+	UPROPERTY()
+	float AnchorTime = 0.0f;
+
+	/** Per second; negative drains. */
+	UPROPERTY()
+	float Rate = 0.0f;
+
+	/** Regeneration waits until this server world time; drains start at once. */
+	UPROPERTY()
+	float RegenStartTime = 0.0f;
+
+	float Evaluate(float Now, float Max) const
+	{
+		const float From = Rate > 0.0f ? FMath::Max(AnchorTime, RegenStartTime) : AnchorTime;
+		return FMath::Clamp(Value + Rate * FMath::Max(0.0f, Now - From), 0.0f, Max);
+	}
+
+	/** Still moving towards its cap or towards empty at Now. */
+	bool IsChanging(float Now, float Max) const
+	{
+		if (Rate > 0.0f) return Now >= RegenStartTime && Evaluate(Now, Max) < Max;
+		return Rate < 0.0f && Evaluate(Now, Max) > 0.0f;
+	}
+
+	void Set(float NewValue, float Max, float Now)
+	{
+		Value = FMath::Clamp(NewValue, 0.0f, Max);
+		AnchorTime = Now;
+	}
+
+	/** Take Amount if that much is there at Now and hold regeneration off for RegenDelay. Otherwise leave the stat alone. */
+	bool Spend(float Amount, float Max, float Now, float RegenDelay)
+	{
+		const float Current = Evaluate(Now, Max);
+		if (Current < Amount) return false;
+
+		Set(Current - Amount, Max, Now);
+		RegenStartTime = Now + RegenDelay;
+		return true;
+	}
+
+	/** Returns whether the rate actually changed. */
+	bool SetRate(float NewRate, float Max, float Now)
+	{
+		if (NewRate == Rate) return false;
+		Set(Evaluate(Now, Max), Max, Now);
+		Rate = NewRate;
+		return true;
+	}
+
+	/** Value to a tenth but never down to zero, Rate exactly, the regen delay to a hundredth of a second. */
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FYomiRegenStat> : public TStructOpsTypeTraitsBase2<FYomiRegenStat>
+{
+	enum { WithNetSerializer = true };
+};
+
 USTRUCT(BlueprintType)
 struct FCraftingRecipe : public FTableRowBase
 {
@@ -813,6 +1091,76 @@ struct FBuildingPieceData : public FTableRowBase
 	float ComfortBonus = 0.0f;
 };
 
+USTRUCT(BlueprintType)
+struct FBuildingBlueprintPiece
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Building")
+	FName PieceID;
+
+	/** Transform relative to the blueprint origin. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Building")
+	FTransform RelativeTransform;
+};
+
+/**
+ * A saved group of building pieces that can be placed again as a single operation.
+ */
+USTRUCT(BlueprintType)
+struct FBuildingBlueprint
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Building")
+	FName BlueprintID;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Building")
+	TArray<FBuildingBlueprintPiece> Pieces;
+};
+
+/**
+ * Shape, damage and knockback of one area attack, resolved with a single registry query.
+ */
+USTRUCT(BlueprintType)
+struct FYomiAreaAttack
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
+	EYomiAreaShape Shape = EYomiAreaShape::None;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat", meta = (ClampMin = "0"))
+	float Radius = 250.0f;
+
+	/** Ring only: targets closer than this are inside the eye of the shockwave. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat", meta = (ClampMin = "0"))
+	float InnerRadius = 0.0f;
+
+	/** Arc and cone: half of the swept angle around the facing direction. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat", meta = (ClampMin = "0", ClampMax = "180"))
+	float HalfAngleDegrees = 90.0f;
+
+	/** Arc and ring: how far above or below the origin a target may stand. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat", meta = (ClampMin = "0"))
+	float HeightTolerance = 150.0f;
+
+	/** Damage per target, scaled by the attacker's multipliers. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
+	float DamageScale = 1.0f;
+
+	/** Horizontal launch speed; zero disables knockback. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
+	float KnockbackForce = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
+	float KnockbackUpward = 0.0f;
+
+	/** Targets further from the origin are pushed less, down to this fraction at the edge. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat", meta = (ClampMin = "0", ClampMax = "1"))
+	float KnockbackFalloff = 0.5f;
+};
+
 // Delegate declarations
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnBiomeChanged, EYomiBiome, NewBiome);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnHonorChanged, float, NewHonor, EHonorLevel, NewLevel);
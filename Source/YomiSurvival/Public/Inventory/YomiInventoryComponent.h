@@ -105,9 +105,9 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Equipment")
 	FYomiInventorySlot GetEquippedArmor(EArmorSlot Slot) const;
 
-	/** Get total armor defense value. */
+	/** Physical plus spirit defense of everything equipped. */
 	UFUNCTION(BlueprintPure, Category = "Equipment")
-	float GetTotalArmorDefense() const;
+	float GetTotalArmorDefense() const { return TotalArmorDefense; }
 
 	// ========================================================================
 	// HOTBAR
@@ -186,6 +186,12 @@ private:
 	UPROPERTY(EditAnywhere, Category = "Inventory")
 	int32 HotbarSize = 8;
 
+	/** Summed when equipment changes, along with the owner's armor modifiers. */
+	float TotalArmorDefense = 0.0f;
+
+	/** Push the equipped pieces' defense, speed and stamina modifiers to the owning character. */
+	void RefreshArmorModifiers();
+
 	int32 FindSlotForItem(FName ItemID) const;
 	int32 FindEmptySlot() const;
 	void RecalculateWeight();
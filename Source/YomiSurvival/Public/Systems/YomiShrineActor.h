@@ -10,6 +10,7 @@
 class USphereComponent;
 class UStaticMeshComponent;
 class UNiagaraComponent;
+class AYomiPlayerCharacter;
 
 /**
  * Shrine actor - provides meditation spot, offering system, and fast travel.
@@ -24,9 +25,9 @@ class YOMISURVIVAL_API AYomiShrineActor : public AActor
 public:
 	AYomiShrineActor();
 
-	/** Make an offering to the shrine. */
+	/** Make an offering to the shrine. The blessing it earns goes to Offerer. */
 	UFUNCTION(BlueprintCallable, Category = "Shrine")
-	bool MakeOffering(FName ItemID, int32 Quantity);
+	bool MakeOffering(FName ItemID, int32 Quantity, AYomiPlayerCharacter* Offerer = nullptr);
 
 	/** Get the current blessing type from offerings. */
 	UFUNCTION(BlueprintPure, Category = "Shrine")
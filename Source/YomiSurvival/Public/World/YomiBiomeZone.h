@@ -82,8 +82,8 @@ private:
 	UPROPERTY()
 	TArray<AYomiResourceNode*> ResourceNodes;
 
-	UPROPERTY()
-	TArray<AYomiEnemyBase*> SpawnedEnemies;
+	/** Living enemies this zone spawned. Weak, since pooled enemies are recycled elsewhere after they die. */
+	TSet<TWeakObjectPtr<AYomiEnemyBase>> SpawnedEnemies;
 
 	UPROPERTY(EditAnywhere, Category = "Biome|Spawning")
 	int32 MaxResourceNodes = 50;
@@ -91,8 +91,15 @@ private:
 	UPROPERTY(EditAnywhere, Category = "Biome|Spawning")
 	int32 MaxEnemies = 20;
 
+	/** Enemy class spawned for each type the biome lists. Types without one are skipped. */
+	UPROPERTY(EditAnywhere, Category = "Biome|Spawning")
+	TMap<EEnemyType, TSubclassOf<AYomiEnemyBase>> EnemyClasses;
+
 	UPROPERTY(EditAnywhere, Category = "Biome|Spawning")
 	float EnemyRespawnTime = 300.0f;
 
 	FVector GetRandomPointInZone() const;
+
+	/** Forget enemies that died, were destroyed or went back to the actor pool. */
+	void PruneSpawnedEnemies();
 };